@@ -35,6 +35,11 @@ class Dataset(SmartWrapper, wrap=link.VAPoR.DataMgr):
     GetMeshNames
     GetMesh
     GetDimLens
+
+    GetCacheStatsVarNames
+    SetSpillCache
+    GetCacheStatsJSON
+    ResetCacheStats
     """)
 
     def __init__(self, dataMgr:link.VAPoR.DataMgr, id:str, ses):
@@ -87,6 +92,16 @@ class Dataset(SmartWrapper, wrap=link.VAPoR.DataMgr):
         self._wrappedInstance.GetDataRange(atTimestep, varname, 0, 0, c_range)
         return list(c_range)
 
+    def GetCacheStats(self, varname: str = "") -> dict:
+        """
+        Returns the data cache performance counters as a dict, either for
+        the variable varname or, if varname is empty, summed over all variables.
+        Counters accumulate until ResetCacheStats() is called.
+        """
+        s = self._wrappedInstance.GetCacheStats(varname)
+        fields = ["exactHits", "containHits", "misses", "evictions", "bytesEvicted", "bytesRead", "bytesDecompressed", "readSeconds", "spillHits", "bytesSpilled"]
+        return {f: getattr(s, f) for f in fields}
+
     @staticmethod
     def GetDatasetTypes():
         return [VDC, WRF, CF, MPAS, BOV, UGRID]
@@ -132,9 +132,11 @@ void AnimationController::setPlay(int direction)
         connect(_myTimer, SIGNAL(timeout()), this, SLOT(playNextFrame()));
         _myTimer->start(msec);
     } else {
-        // Done animating. Disable timer and send notification
+        // Done animating. Disable timer, discard any pending reads
+        // of upcoming frames, and send notification
         //
         disconnect(_myTimer, 0, 0, 0);
+        _controlExec->CancelPrefetch();
         GUIStateParams* gsp = NavigationUtils::GetGUIStateParams(_controlExec);
     
         string windowName = gsp->GetActiveVizName();
@@ -182,9 +184,23 @@ void AnimationController::playNextFrame()
     _controlExec->GetParamsMgr()->SetSaveStateUndoEnabled(false);
     setCurrentTimestep(currentFrame);
     _controlExec->GetParamsMgr()->SetSaveStateUndoEnabled(undoEnabled);
+    prefetchFrames(currentFrame, startFrame, endFrame);
     emit AnimationDrawSignal();
 }
 
+// Start reading the next few frames while the current one renders
+//
+void AnimationController::prefetchFrames(int currentFrame, int startFrame, int endFrame) const
+{
+    std::vector<size_t> frames;
+    for (int i = 1; i <= _numPrefetchFrames; i++) {
+        int frame = currentFrame + i * _direction;
+        if (frame < startFrame || frame > endFrame) break;
+        frames.push_back(frame);
+    }
+    if (frames.size()) _controlExec->PrefetchTimesteps(frames);
+}
+
 AnimationParams *AnimationController::GetActiveParams() const { return NavigationUtils::GetAnimationParams(_controlExec); }
 
 void AnimationController::_updateTab() { Update(); }
@@ -20,6 +20,10 @@ class AnimationController : public QObject {
     bool                _animationOn = false;
     bool                _capturingImageSequence;
 
+    // Number of upcoming frames to read in the background while animating
+    //
+    static const int _numPrefetchFrames = 2;
+
 public:
     AnimationController(VAPoR::ControlExec *ce);
     void Update();
@@ -49,6 +53,7 @@ private:
     void             setPlay(int direction);
     AnimationParams *GetActiveParams() const;
     void             _updateTab();
+    void             prefetchFrames(int currentFrame, int startFrame, int endFrame) const;
 
 private slots:
     void playNextFrame();
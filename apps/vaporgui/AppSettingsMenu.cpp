@@ -118,6 +118,10 @@ AppSettingsMenu::AppSettingsMenu(QWidget *parent) : QDialog(parent), ParamsUpdat
                                             ->SetRange(1, 1024)
                                             ->EnableBasedOnParam(SettingsParams::UseAllCoresTag, false)}),
                          new PIntegerInputHLI<SettingsParams>("Cache size (Megabytes)", &SettingsParams::GetCacheMB, &SettingsParams::SetCacheMB),
+                         new PCheckboxHLI<SettingsParams>("Locate cells of unstructured grids with a BVH", &SettingsParams::GetUseBVHCellLocator, &SettingsParams::SetUseBVHCellLocator),
+                         new PCheckboxHLI<SettingsParams>("Keep cell locators on disk", &SettingsParams::GetLocatorCacheEnabled, &SettingsParams::SetLocatorCacheEnabled),
+                         (new PDirectorySelectorHLI<SettingsParams>("Cell locator directory", &SettingsParams::GetLocatorCacheDir, &SettingsParams::SetLocatorCacheDir))
+                             ->EnableBasedOnParam(SettingsParams::LocatorCacheEnabledTag),
                          new PCheckboxHLI<SettingsParams>("Check for and show notices on startup", &SettingsParams::GetAutoCheckForNotices, &SettingsParams::SetAutoCheckForNotices),
                      }),
         new PSection("Default Search Paths", {new PDirectorySelectorHLI<SettingsParams>("Session file path", &SettingsParams::GetSessionDir, &SettingsParams::SetSessionDir),
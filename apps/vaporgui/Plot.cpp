@@ -498,31 +498,33 @@ void Plot::_spaceTabPlotClicked()
     std::vector<double> p1p2span;
     for (int i = 0; i < point1.size(); i++) p1p2span.push_back(point2[i] - point1[i]);
 
+    std::vector<VAPoR::CoordType> samples(numOfSamples, {0.0, 0.0, 0.0});
+    for (int i = 0; i < numOfSamples; i++) {
+        for (int j = 0; j < point1.size() && j < 3; j++) {
+            if (i == 0)
+                samples[i][j] = point1[j];
+            else if (i == numOfSamples - 1)
+                samples[i][j] = point2[j];
+            else
+                samples[i][j] = (double)i / (double)(numOfSamples - 1) * p1p2span[j] + point1[j];
+        }
+    }
+
+    // Only the blocks along the line are read
+    //
     std::vector<std::vector<float>> sequences;
     for (int v = 0; v < enabledVars.size(); v++) {
         std::vector<float> seq(numOfSamples, 0.0);
-        VAPoR::Grid *      grid = dataMgr->GetVariable(currentTS, enabledVars[v], refinementLevel, compressLevel);
-        if (grid) {
-            float missingVal = grid->GetMissingValue();
-            for (int i = 0; i < numOfSamples; i++) {
-                std::vector<double> sample;
-                if (i == 0)
-                    sample = point1;
-                else if (i == numOfSamples - 1)
-                    sample = point2;
-                else {
-                    for (int j = 0; j < point1.size(); j++) sample.push_back((double)i / (double)(numOfSamples - 1) * p1p2span[j] + point1[j]);
-                }
-                float fieldVal = grid->GetValue(sample);
-                if (fieldVal == missingVal)
-                    seq[i] = std::nanf("1");
-                else
-                    seq[i] = fieldVal;
-            }
-            sequences.push_back(seq);
-        }
+        if (dataMgr->SampleAtPoints(currentTS, enabledVars[v], refinementLevel, compressLevel, samples, seq.data()) < 0) continue;
+
+        VAPoR::DC::DataVar dvar;
+        float              missingVal = std::numeric_limits<float>::infinity();
+        if (dataMgr->GetDataVarInfo(enabledVars[v], dvar) && dvar.GetHasMissing()) missingVal = dvar.GetMissingValue();
 
-        delete grid;
+        for (int i = 0; i < numOfSamples; i++) {
+            if (seq[i] == missingVal) seq[i] = std::nanf("1");
+        }
+        sequences.push_back(seq);
     }
 
     // Decide X label and values
@@ -575,20 +577,26 @@ void Plot::_timeTabPlotClicked()
     // Do nothing if no variable is enabled
     if (enabledVars.size() == 0) return;
 
+    VAPoR::CoordType point = {0.0, 0.0, 0.0};
+    for (int j = 0; j < singlePt.size() && j < 3; j++) point[j] = singlePt[j];
+
+    // Only the block containing the point is read at each time step.
+    // Time steps that can't be read, and missing values, are plotted
+    // as gaps
+    //
     std::vector<std::vector<float>> sequences;
     for (int v = 0; v < enabledVars.size(); v++) {
         std::vector<float> seq;
-        for (int t = minMaxTS[0]; t <= minMaxTS[1]; t++) {
-            VAPoR::Grid *grid = dataMgr->GetVariable(t, enabledVars[v], refinementLevel, compressLevel);
-            if (grid) {
-                float fieldVal = grid->GetValue(singlePt);
-                if (fieldVal != grid->GetMissingValue())
-                    seq.push_back(fieldVal);
-                else
-                    seq.push_back(std::nanf("1"));
-            }
+        if (dataMgr->GetTimeSeries(enabledVars[v], refinementLevel, compressLevel, {point}, minMaxTS[0], minMaxTS[1], seq) == 0) {
+            VAPoR::DC::DataVar dvar;
+            float              missingVal = std::numeric_limits<float>::infinity();
+            if (dataMgr->GetDataVarInfo(enabledVars[v], dvar) && dvar.GetHasMissing()) missingVal = dvar.GetMissingValue();
 
-            delete grid;
+            for (auto &fieldVal : seq) {
+                if (fieldVal == missingVal) fieldVal = std::nanf("1");
+            }
+        } else if (minMaxTS.size() > 1) {
+            seq.assign(minMaxTS[1] - minMaxTS[0] + 1, std::nanf("1"));
         }
         sequences.push_back(seq);
     }
@@ -103,6 +103,11 @@ private:
 
     int _sizeOfFormat(DC::XType) const;
 
+    // Read a region through a read-only memory mapping of dataFile.
+    // Returns false, without setting an error, if the file can't be mapped
+    //
+    template<class T> bool _readRegionMapped(const std::string &dataFile, const std::vector<size_t> &min, const std::vector<size_t> &max, T region) const;
+
     int _invalidVarNameError() const;
     int _invalidFileSizeError(size_t numElements) const;
     int _invalidFileError() const;
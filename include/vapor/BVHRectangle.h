@@ -0,0 +1,179 @@
+#pragma once
+
+#include <vector>
+#include <array>
+#include <iostream>
+#include <cstdint>
+#include <vapor/common.h>
+#include <vapor/Grid.h>
+
+namespace VAPoR {
+
+//
+//! \class BVHRectangle
+//! \brief A bounding volume hierarchy over axis aligned rectangles
+//!
+//! This class is an alternative to QuadTreeRectangleP for finding the
+//! cells of a 2D mesh that may contain a point. Each rectangle (typically
+//! the bounding rectangle of a cell) is stored exactly once, in a leaf of
+//! a binary tree whose splits are chosen with the surface area heuristic
+//! (SAH). Unlike the quad tree there is no depth limit and no payload
+//! duplication, so meshes with very anisotropic or very unevenly sized
+//! cells (e.g. MPAS meshes) still yield short candidate lists.
+//!
+//! The tree is built in parallel, and then stored in two flat arrays: the
+//! nodes, in depth first order, and the rectangles, in leaf order. A node
+//! is 24 bytes, and the left child of an interior node immediately follows
+//! it.
+//!
+//! Rectangles follow the conventions of QuadTreeRectangle: \p top is the
+//! minimum and \p bottom the maximum Y coordinate, and a point on the
+//! boundary of a rectangle is contained by it.
+//!
+//
+class VDF_API BVHRectangle {
+public:
+    using payload_t = std::array<uint32_t, 2>;
+
+    class rectangle_t {
+    public:
+        rectangle_t() : _left(0.0), _top(0.0), _right(0.0), _bottom(0.0) {}
+        rectangle_t(float left, float top, float right, float bottom) : _left(left), _top(top), _right(right), _bottom(bottom) {}
+
+        bool contains(float x, float y) const { return ((_left <= x) && (_right >= x) && (_top <= y) && (_bottom >= y)); }
+        bool intersects(const rectangle_t &other) const { return (!(_left > other._right || _top > other._bottom || _right < other._left || _bottom < other._top)); }
+
+        float _left;
+        float _top;
+        float _right;
+        float _bottom;
+    };
+
+    //! Construct an empty hierarchy
+    //!
+    //! \param[in] leaf_size The number of rectangles below which a node is
+    //! always made a leaf. Larger leaves are created only if the SAH
+    //! predicts that splitting them would not pay off.
+    //
+    BVHRectangle(size_t leaf_size = 4);
+
+    //! Build the hierarchy from a list of rectangles
+    //!
+    //! Any previous contents are discarded.
+    //!
+    //! \param[in] rectangles The rectangles
+    //! \param[in] payloads The payload associated with each rectangle.
+    //! Must have the same size as \p rectangles
+    //!
+    void Build(const std::vector<rectangle_t> &rectangles, const std::vector<payload_t> &payloads);
+
+    //! Build the hierarchy from the cells contained in a Grid class
+    //!
+    //! This method computes the bounding rectangle of every cell in
+    //! \p grid, and builds the hierarchy from them, using the cell's
+    //! indices as the payload. The work is performed in parallel. The
+    //! topological dimension of \p grid must be two.
+    //!
+    //! \param[in] grid The grid from which to construct the hierarchy
+    //! \param[in] ncells If non-zero specifies the number of cells to
+    //! insert via iterating over the cells contained in the grid. If zero,
+    //! all of the cells are inserted.
+    //!
+    //! \sa QuadTreeRectangleP::Insert()
+    //
+    void Build(const Grid *grid, size_t ncells = 0);
+
+    //! Return the payloads of all rectangles containing a point
+    //!
+    //! \sa QuadTreeRectangleP::GetPayloadContained()
+    //
+    void GetPayloadContained(float x, float y, std::vector<DimsType> &payloads) const;
+
+    //! Return the payloads of all rectangles containing each of a batch
+    //! of points
+    //!
+    //! The results are returned in compressed row form: the payloads
+    //! of the rectangles containing point \p i are stored in
+    //! \p payloads[offsets[i]] through \p payloads[offsets[i+1]-1].
+    //!
+    //! \param[in] xy An array of 2 * \p n interleaved point coordinates
+    //! (x0, y0, x1, y1, ...)
+    //! \param[in] n The number of points
+    //! \param[out] offsets A vector of \p n + 1 offsets into \p payloads
+    //! \param[out] payloads The payloads of the containing rectangles
+    //!
+    //! The points are processed in parallel.
+    //
+    void GetPayloadContained(const double *xy, size_t n, std::vector<size_t> &offsets, std::vector<DimsType> &payloads) const;
+
+    //! Return the payloads of all rectangles intersecting a rectangle
+    //!
+    //! \sa QuadTreeRectangleP::GetPayloadIntersected()
+    //
+    void GetPayloadIntersected(float left, float top, float right, float bottom, std::vector<DimsType> &payloads) const;
+
+    //! Return statistics about the hierarchy
+    //!
+    //! \param[out] payload_histo A histogram of the number of rectangles
+    //! stored in each leaf
+    //! \param[out] level_histo A histogram of the depth of each leaf
+    //!
+    //! \sa QuadTreeRectangleP::GetStats()
+    //
+    void GetStats(std::vector<size_t> &payload_histo, std::vector<size_t> &level_histo) const;
+
+    //! Return the number of nodes in the hierarchy
+    //
+    size_t GetNumNodes() const { return (_nodes.size()); }
+
+    //! Append a flat binary image of the hierarchy to a buffer
+    //!
+    //! The image is a copy of the node, rectangle, and payload arrays.
+    //! It is only readable on a host with the same byte order.
+    //!
+    //! \sa Deserialize(), LocatorCache
+    //
+    void Serialize(std::vector<unsigned char> &buf) const;
+
+    //! Replace the hierarchy with an image created by Serialize()
+    //!
+    //! \param[in] buf Image
+    //! \param[in] nbytes Size of \p buf in bytes
+    //!
+    //! \retval status Returns false, and leaves the hierarchy unchanged, if
+    //! the image is truncated or inconsistent
+    //
+    bool Deserialize(const unsigned char *buf, size_t nbytes);
+
+    friend std::ostream &operator<<(std::ostream &os, const BVHRectangle &b)
+    {
+        std::vector<size_t> payload_histo, level_histo;
+        b.GetStats(payload_histo, level_histo);
+        os << "Num nodes : " << b._nodes.size() << std::endl;
+        os << "Num rectangles : " << b._rectangles.size() << std::endl;
+        os << "Max depth : " << (level_histo.size() ? level_histo.size() - 1 : 0) << std::endl;
+        return (os);
+    }
+
+private:
+    // A leaf has a non-zero count, and 'offset' is the index of its first
+    // rectangle. An interior node has a zero count, its left child is the
+    // next node, and 'offset' is the index of its right child
+    //
+    struct node_t {
+        rectangle_t bounds;
+        uint32_t    offset;
+        uint32_t    count;
+    };
+
+    size_t                   _leafSize;
+    size_t                   _maxDepth;
+    std::vector<node_t>      _nodes;
+    std::vector<rectangle_t> _rectangles;
+    std::vector<payload_t>   _payloads;
+
+    void _build(std::vector<rectangle_t> &rectangles, std::vector<payload_t> &payloads);
+
+    template<class F> void _forEachContaining(float x, float y, F f) const;
+};
+};    // namespace VAPoR
@@ -5,6 +5,10 @@
 #ifndef _BlkMemMgr_h_
 #define _BlkMemMgr_h_
 
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <mutex>
 #include <vapor/MyBase.h>
 
 namespace VAPoR {
@@ -19,11 +23,17 @@ namespace VAPoR {
 //! A block-based memory allocator. Allocates contiguous runs of
 //! memory blocks from a memory pool of user defined size.
 //!
+//! Free runs are indexed both by size and by address. Allocation
+//! takes the smallest free run that satisfies a request (best fit), and
+//! freed runs are coalesced with their free neighbors, so that both
+//! Alloc() and FreeMem() are O(log n) in the number of free runs.
+//! The allocator may be used concurrently from multiple threads.
+//!
 //! N.B. the memory pool is stored in a static class member and
 //! can only be freed by calling RequestMemSize() with a zero value
 //! after all instances of this class have been destroyed
 //
-class BlkMemMgr : public Wasp::MyBase {
+class VDF_API BlkMemMgr : public Wasp::MyBase {
 public:
     //! Initialize a memory allocator
     //
@@ -68,16 +78,42 @@ public:
 
     static size_t GetBlkSize() { return (_blk_size); }
 
+    //! Memory pool usage statistics, all sizes in blocks
+    //
+    typedef struct {
+        size_t poolBlks;          // blocks currently in memory pool
+        size_t maxPoolBlks;       // maximum size the pool may grow to
+        size_t usedBlks;          // blocks allocated with Alloc()
+        size_t freeBlks;          // blocks in the pool available for Alloc()
+        size_t freeRuns;          // number of runs of contiguous free blocks
+        size_t largestFreeRun;    // largest request that can be met without growing pool
+        size_t numAllocs;         // number of outstanding allocations
+    } stats_t;
+
+    //! Return memory pool usage statistics
+    //
+    static void GetStats(stats_t &stats);
+
+    //! Return memory pool fragmentation
+    //!
+    //! Returns a value between 0.0 and 1.0 computed as one minus the
+    //! ratio of the largest free run to the total number of free blocks.
+    //! A value of 0.0 indicates that all free space is contiguous.
+    //
+    static double GetFragmentation();
+
 private:
     typedef struct {
-        size_t _nfree;    // number of contiguous free blocks
-        size_t _nused;    // number of contiguous used blocks
-        void * _blk;      // pointer to first free/used block
-    } _mem_allocation_t;
+        size_t _nblks;     // number of contiguous blocks in run
+        int    _region;    // index of memory region containing run
+    } _mem_run_t;
 
-    static vector<vector<_mem_allocation_t>> _mem_regions;
-    static vector<size_t>                    _mem_region_sizes;    // size of mem in blocks
-    static vector<unsigned char *>           _blks;                // memory pool
+    static std::map<unsigned char *, _mem_run_t>        _free_by_addr;        // free runs by address
+    static std::set<std::pair<size_t, unsigned char *>> _free_by_size;        // free runs by size
+    static std::unordered_map<void *, _mem_run_t>       _used;                // allocated runs
+    static vector<size_t>                               _mem_region_sizes;    // size of mem in blocks
+    static vector<unsigned char *>                      _blks;                // memory pool
+    static std::mutex                                   _mutex;               // protects all of the above
 
     static size_t _mem_size_max_req;    // max requested size of mem in blocks
     static bool   _page_aligned_req;    // requested page align memory
@@ -89,7 +125,10 @@ private:
 
     static int _ref_count;    // # instances of object.
 
-    static int _Reinit(size_t n);
+    static int  _Reinit(size_t n);
+    static void _insert_free(unsigned char *blk, _mem_run_t run);
+    static void _erase_free(std::map<unsigned char *, _mem_run_t>::iterator itr);
+    static void _free_pool();
 };
 };    // namespace VAPoR
 
@@ -329,6 +329,23 @@ public:
     //!
     void CloseData(string dataSetName);
 
+    //! Read data for upcoming time steps in the background
+    //!
+    //! Queues asynchronous reads, via DataMgr::Prefetch(), of the
+    //! variables used by every enabled renderer at each of the global
+    //! time steps in \p timesteps. Typically called during animation
+    //! to hide the I/O latency of the next frames.
+    //!
+    //! \sa CancelPrefetch(), DataMgr::Prefetch()
+    //
+    void PrefetchTimesteps(const std::vector<size_t> &timesteps);
+
+    //! Cancel outstanding prefetch requests for all data sets
+    //!
+    //! \sa PrefetchTimesteps()
+    //
+    void CancelPrefetch();
+
     //! Return list of currently open data set names
     //!
     //! \sa OpenData(), CloseData()
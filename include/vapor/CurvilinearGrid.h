@@ -178,6 +178,28 @@ public:
     //!
     virtual bool GetIndicesCell(const CoordType &coords, DimsType &indices) const override;
 
+    //! \copydoc Grid::GetIndicesCell(const CoordType &, const DimsType &, DimsType &) const
+    //!
+    //! The hint cell is tested first. If it does not contain the point
+    //! the search walks from cell to neighboring cell, crossing the cell
+    //! edge that the point lies beyond, and falls back to the quad tree
+    //! only if the walk leaves the grid or does not converge in a few
+    //! steps.
+    //!
+    virtual bool GetIndicesCell(const CoordType &coords, const DimsType &hintCell, DimsType &indices) const override;
+
+    // For grandparent inheritance of
+    // Grid::GetIndicesCell(const double coords[3], size_t indices[3])
+    //
+    using Grid::GetIndicesCell;
+
+    //! \copydoc Grid::GetValues()
+    //!
+    //! The cell containing each point is used as the hint cell when
+    //! locating the next one.
+    //
+    virtual void GetValues(const double *xyz, size_t n, float *values) const override;
+
     // \copydoc GetGrid::InsideGrid()
     //
     virtual bool InsideGrid(const CoordType &coords) const override;
@@ -261,7 +283,11 @@ private:
 
     bool _insideFace(const DimsType &face, double pt[2], double lambda[4], std::vector<DimsType> &nodes) const;
 
-    bool _insideGrid(double x, double y, double z, size_t &i, size_t &j, size_t &k, double lambda[4], double zwgt[2]) const;
+    bool _insideGrid(double x, double y, double z, size_t &i, size_t &j, size_t &k, double lambda[4], double zwgt[2], const DimsType *hint = nullptr) const;
+
+    bool _walkToFace(const DimsType &start, double pt[2], double lambda[4], DimsType &face) const;
+
+    float _getValueLinear(const CoordType &cCoords, DimsType *cell) const;
 
     void _getIndicesHelper(const std::vector<double> &coords, std::vector<size_t> &indices) const;
 
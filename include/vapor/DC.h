@@ -1688,6 +1688,32 @@ public:
     virtual int ReadRegion(int fd, const vector<size_t> &min, const vector<size_t> &max, double *region) { return (readRegion(fd, min, max, region)); }
     virtual int ReadRegion(int fd, const vector<size_t> &min, const vector<size_t> &max, int *region) { return (readRegion(fd, min, max, region)); }
 
+    //! Return the range of values of a subregion from stored metadata
+    //!
+    //! Some data collections record the minimum and maximum value of
+    //! each storage block when the data are written. For these, this
+    //! method returns the range of the values in the blocks intersecting
+    //! the subregion of the currently opened variable identified by \p min
+    //! and \p max, without reading the data themselves. The range is that
+    //! of the data as written, at the native resolution, whatever the
+    //! refinement level and level of detail the variable was opened with.
+    //! At the native resolution it is exact for subregions aligned to the
+    //! storage blocks (see GetDimLensAtLevel()), and otherwise contains the
+    //! range of the subregion.
+    //!
+    //! \param[in] fd A valid file descriptor returned by OpenVariableRead()
+    //! \param[in] min Minimum region extents in grid coordinates
+    //! \param[in] max Maximum region extents in grid coordinates
+    //! \param[out] range A two element vector containing the minimum and
+    //! maximum value, respectively
+    //!
+    //! \retval status Returns 1 on success, 0 if the range is not
+    //! available from metadata, or a negative value on failure
+    //!
+    //! \sa ReadRegion()
+    //
+    virtual int ReadRegionRange(int fd, const vector<size_t> &min, const vector<size_t> &max, vector<double> &range) { return (readRegionRange(fd, min, max, range)); }
+
 
     //! Read an entire variable in one call
     //!
@@ -2208,6 +2234,14 @@ protected:
 
     virtual int readRegion(int fd, const vector<size_t> &min, const vector<size_t> &max, int *region) = 0;
 
+    //! \copydoc ReadRegionRange()
+    //
+    virtual int readRegionRange(int fd, const vector<size_t> &min, const vector<size_t> &max, vector<double> &range)
+    {
+        range.clear();
+        return (0);
+    }
+
     //! \copydoc VariableExists()
     //
     virtual bool variableExists(size_t ts, string varname, int reflevel = 0, int lod = 0) const = 0;
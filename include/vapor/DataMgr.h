@@ -1,8 +1,19 @@
 #include <vector>
 #include <iostream>
 #include <list>
+#include <memory>
+#include <set>
+#include <unordered_map>
+#include <mutex>
+#include <shared_mutex>
+#include <future>
+#include <thread>
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include "vapor/VAssert.h"
 #include <vapor/BlkMemMgr.h>
+#include <vapor/SpillCache.h>
 #include <vapor/DC.h>
 #include <vapor/MyBase.h>
 #include <vapor/RegularGrid.h>
@@ -150,6 +161,7 @@ public:
     std::vector<string> GetDimensionNames() const
     {
         VAssert(_dc);
+        std::lock_guard<std::recursive_mutex> readGuard(_readMutex);
         return (_dc->GetDimensionNames());
     }
 
@@ -158,6 +170,7 @@ public:
     bool GetAtt (string varname, string attname, vector< double > &values) const
     {
         VAssert(_dc);
+        std::lock_guard<std::recursive_mutex> readGuard(_readMutex);
         return (_dc->GetAtt(varname, attname, values));
     }
 
@@ -166,6 +179,7 @@ public:
     bool GetAtt (string varname, string attname, vector<long> &values) const
     {
         VAssert(_dc);
+        std::lock_guard<std::recursive_mutex> readGuard(_readMutex);
         return (_dc->GetAtt(varname, attname, values));
     }
 
@@ -174,6 +188,7 @@ public:
     bool GetAtt (string varname, string attname, string &values) const
     {
         VAssert(_dc);
+        std::lock_guard<std::recursive_mutex> readGuard(_readMutex);
         return (_dc->GetAtt(varname, attname, values));
     }
 
@@ -182,6 +197,7 @@ public:
     std::vector<string> GetAttNames(string varname) const
     {
         VAssert(_dc);
+        std::lock_guard<std::recursive_mutex> readGuard(_readMutex);
         return (_dc->GetAttNames(varname));
     }
 
@@ -190,6 +206,7 @@ public:
     DC::XType GetAttType(string varname, string attname) const
     {
         VAssert(_dc);
+        std::lock_guard<std::recursive_mutex> readGuard(_readMutex);
         return (_dc->GetAttType(varname, attname));
     }
 
@@ -198,6 +215,7 @@ public:
     bool GetDimension(string dimname, DC::Dimension &dimension, long ts) const
     {
         VAssert(_dc);
+        std::lock_guard<std::recursive_mutex> readGuard(_readMutex);
         return (_dc->GetDimension(dimname, dimension, ts));
     }
     
@@ -220,6 +238,7 @@ public:
     std::vector<string> GetMeshNames() const
     {
         VAssert(_dc);
+        std::lock_guard<std::recursive_mutex> readGuard(_readMutex);
         return (_dc->GetMeshNames());
     }
 
@@ -437,6 +456,13 @@ public:
     //!
     //! \param[in] lod The level-of-detail parameter, \p lod, selects
     //! the approximation level. See DataMgr.
+    //!
+    //! \note GetVariable() and UnlockGrid() may be called concurrently
+    //! from multiple threads. Threads requesting the same region share
+    //! a single read from the file system. Regions already in the cache
+    //! are returned concurrently, but the data collection is not thread
+    //! safe: reads from the file system, and queries of the data
+    //! collection's metadata, are serialized.
     //
     VAPoR::Grid *GetVariable(size_t ts, string varname, int level, int lod, bool lock = false);
 
@@ -468,10 +494,90 @@ public:
     //! it is the caller's responsiblity to delete the returned object
     //! when it is no longer in use.
     //!
+    //! \note For UnstructuredGrid2D and UnstructuredGridLayered variables
+    //! sampled at nodes only the data of the range of nodes used by the
+    //! faces intersecting the box are read, and the grid returned is
+    //! built on the sub-mesh of those faces. However, the coordinates and
+    //! connectivity of the entire mesh are still read to find the faces
+    //! and to build the sub-mesh. They are cached like other regions, so
+    //! are usually read only once.
+    //!
     VAPoR::Grid *GetVariable(size_t ts, string varname, int level, int lod, CoordType min, CoordType max, bool lock = false);
 
     VAPoR::Grid *GetVariable(size_t ts, string varname, int level, int lod, DimsType min, DimsType max, bool lock = false);
 
+    //! Read and return several variable hyperslabs at once
+    //!
+    //! This method is equivalent to calling GetVariable() for each of
+    //! the variables named in \p varnames with the same time step,
+    //! refinement, level-of-detail, and region-of-interest. The variables
+    //! (e.g. the components of a vector field) are requested concurrently,
+    //! so that regions already in the cache, and the construction of the
+    //! grids, overlap with reading. Reads from the data collection are
+    //! serialized, however (see GetVariable()), so when none of the
+    //! variables are cached this method is no faster than reading them
+    //! one at a time.
+    //!
+    //! \param[in] varnames The names of the variables to read. Empty
+    //! names are permitted, and result in a NULL grid.
+    //! \param[out] grids On success a vector, the same length as
+    //! \p varnames, containing the Grid for each variable. The caller is
+    //! responsible for deleting the grids.
+    //!
+    //! \retval status A negative value is returned if any of the variables
+    //! could not be read. In this case no grids are returned, and
+    //! none of the variables remain locked.
+    //!
+    //! \sa GetVariable()
+    //
+    int GetVariables(size_t ts, const std::vector<string> &varnames, int level, int lod, CoordType min, CoordType max, bool lock, std::vector<VAPoR::Grid *> &grids);
+
+    int GetVariables(size_t ts, const std::vector<string> &varnames, int level, int lod, DimsType min, DimsType max, bool lock, std::vector<VAPoR::Grid *> &grids);
+
+    //! Sample a variable at a set of scattered points
+    //!
+    //! This method is equivalent to calling Grid::GetValue() for each point
+    //! in \p points on the Grid returned by GetVariable(). However, only the
+    //! blocks of the variable needed to interpolate the points are read.
+    //! The points are grouped by the blocks that contain them, and the
+    //! groups are fetched and sampled concurrently.
+    //!
+    //! \param[in] points The points to sample, in user coordinates
+    //! \param[out] values An array of at least \p points.size() elements
+    //! that, on success, contains the value of the variable at each point.
+    //! Points outside of the variable's domain are assigned the grid's
+    //! missing value (see Grid::GetMissingValue()).
+    //!
+    //! \retval status A negative int is returned on failure
+    //!
+    //! \sa GetVariable()
+    //
+    int SampleAtPoints(size_t ts, string varname, int level, int lod, const std::vector<CoordType> &points, float *values);
+
+    //! Sample a variable at a set of points over a range of time steps
+    //!
+    //! This method is equivalent to calling SampleAtPoints() for each
+    //! time step from \p ts0 to \p ts1, inclusive. Only the blocks
+    //! containing the points are read at each time step. Regions read
+    //! by this method, of the variable and of its coordinate variables,
+    //! are the first to be evicted from the cache, so that extracting a
+    //! long time series does not displace the data in use elsewhere.
+    //! The values at time steps that can't be sampled are NaN.
+    //!
+    //! \param[in] points The points to sample, in user coordinates
+    //! \param[in] ts0 First time step
+    //! \param[in] ts1 Last time step
+    //! \param[out] values On success the values of the variable, ordered
+    //! by time step and then by point: the value at point \a i and time
+    //! step \a ts is at index (\a ts - \p ts0) * \p points.size() + \a i.
+    //!
+    //! \retval status A negative int is returned on failure, or if none of
+    //! the time steps can be sampled
+    //!
+    //! \sa SampleAtPoints()
+    //
+    int GetTimeSeries(string varname, int level, int lod, const std::vector<CoordType> &points, size_t ts0, size_t ts1, std::vector<float> &values);
+
     //! Compute the coordinate extents of a variable
     //!
     //! This method finds the spatial domain extents of a variable
@@ -498,13 +604,52 @@ public:
     //! Compute min and max value of a variable within a specified ROI
     //!
     //! This method finds the minimum and maximum value of a variable within
-    //! the region of interest (ROI) specified by \p min and \p max. Note, the
+    //! the region of interest (ROI) specified by \p min and \p max.
+    //!
+    //! If \p level and \p lod are the finest available and the data
+    //! collection records the range of each storage block
+    //! (see DC::ReadRegionRange()) the range is computed from these, without
+    //! reading the variable's data. In this case the range is that of the
+    //! storage blocks intersecting the grid bounding the ROI, and may be
+    //! larger than the range of the grid itself. Otherwise the
     //! results returned by this method are equivalent to calling the
     //! Grid::GetRange() method on a grid returned by DataMgr::GetVariable
     //! using the same arguments provided here.
     //
     int GetDataRange(size_t ts, string varname, int level, int lod, CoordType min, CoordType max, std::vector<double> &range);
 
+    //! Find the blocks of a variable that may contain values in a range
+    //!
+    //! The grid of a variable is partitioned into blocks of dimension
+    //! \p bs. This method returns the coordinates, in blocks, of
+    //! the blocks that may contain values in the closed interval
+    //! [\p vmin, \p vmax], allowing contouring and thresholding
+    //! operations to skip, and avoid reading, blocks that cannot
+    //! contribute to their results. Each block is extended by a one voxel
+    //! halo on its upper faces, so that any cell whose first node lies
+    //! in a block that is not returned has no values in the interval.
+    //! Missing values are ignored.
+    //!
+    //! At the finest refinement level and level of detail the value range
+    //! of each block is obtained from the per-block ranges
+    //! recorded by the data collection, if available (see
+    //! DC::ReadRegionRange()). Otherwise it is obtained from the variable's
+    //! data at \p level and \p lod the
+    //! first time they are read after this method is called. Blocks
+    //! whose range is not yet known are always returned.
+    //!
+    //! \param[in] vmin Minimum of the value range
+    //! \param[in] vmax Maximum of the value range
+    //! \param[out] bs Dimensions of each block, in voxels
+    //! \param[out] blocks Coordinates of the blocks that may contain
+    //! values in the range
+    //!
+    //! \retval status A negative int is returned on failure
+    //!
+    //! \sa GetDataRange()
+    //
+    int GetBlocksInValueRange(size_t ts, string varname, int level, int lod, double vmin, double vmax, DimsType &bs, std::vector<DimsType> &blocks);
+
     //! \copydoc DC::GetDimLensAtLevel()
     //!
     virtual int GetDimLensAtLevel(string varname, int level, std::vector<size_t> &dims_at_level, long ts) const
@@ -544,6 +689,304 @@ public:
     //
     void UnlockGrid(const VAPoR::Grid *rg);
 
+    //! Asynchronously read variables into the cache
+    //!
+    //! Queues requests to read the region of interest of each variable
+    //! in \p varnames into the memory cache, and returns immediately.
+    //! The requests are serviced in the order received by a pool of
+    //! background threads. A subsequent GetVariable() call for the
+    //! same region either finds the data in the cache, or waits for
+    //! the read already in progress.
+    //!
+    //! Prefetching never evicts regions from the cache: a request that
+    //! does not fit in the free capacity is dropped. Prefetched regions
+    //! are not locked and may be evicted from the cache before they are
+    //! used. Errors encountered while prefetching are not reported.
+    //! Variables that may only be read on the calling thread, e.g.
+    //! Python derived variables (see DerivedVar::IsThreadSafe()), are
+    //! not prefetched.
+    //!
+    //! \param[in] ts Time step
+    //! \param[in] varnames Names of the variables to read. Empty names
+    //! are ignored
+    //! \param[in] level Grid refinement level. See DataMgr
+    //! \param[in] lod Level-of-detail. See DataMgr
+    //! \param[in] min Minimum extents of the region-of-interest, in user
+    //! coordinates. See GetVariable()
+    //! \param[in] max Maximum extents of the region-of-interest, in user
+    //! coordinates. See GetVariable()
+    //!
+    //! \sa CancelPrefetch(), GetVariable()
+    //
+    int Prefetch(size_t ts, const std::vector<string> &varnames, int level, int lod, CoordType min, CoordType max);
+
+    //! Cancel outstanding prefetch requests
+    //!
+    //! Discards all queued prefetch requests, including pending
+    //! refinements requested by GetVariableProgressive(), and returns
+    //! without waiting for the reads already in progress. Those complete
+    //! in the background and their regions are cached, but no refinement
+    //! requested before CancelPrefetch() is delivered after it returns.
+    //!
+    //! \sa Prefetch(), GetVariableProgressive()
+    //
+    void CancelPrefetch();
+
+    //! Callback invoked with each refinement of a progressive read
+    //!
+    //! \param[in] grid The refined grid. Ownership is passed to the
+    //! callback. The grid is locked, and the callback, or whoever it
+    //! hands the grid to, must call UnlockGrid() and then delete it.
+    //! \param[in] level The refinement level of \p grid
+    //! \param[in] lod The level-of-detail of \p grid
+    //!
+    //! \sa GetVariableProgressive()
+    //
+    typedef std::function<void(VAPoR::Grid *grid, int level, int lod)> RefinementCallback;
+
+    //! Read a variable progressively, coarsest resolution first
+    //!
+    //! Returns a grid for the region of interest at the coarsest
+    //! refinement level and level-of-detail. Successively finer
+    //! levels and levels-of-detail, up to \p level and \p lod, are
+    //! then read in the background by the threads that service
+    //! Prefetch(), and each is passed to \p callback as it becomes
+    //! available. Refinements are delivered in order of increasing
+    //! resolution; a refinement that completes after a finer one has
+    //! been delivered is discarded. \p callback is invoked from a
+    //! background thread, never concurrently for the same request.
+    //!
+    //! Pending refinements are discarded by CancelPrefetch().
+    //! Like Prefetch(), intermediate refinements only use free cache
+    //! capacity, and are skipped if there is too little. The final
+    //! refinement, at \p level and \p lod, may evict regions from the
+    //! cache to make room, as GetVariable() does. So while it is pending
+    //! grids returned unlocked by GetVariable() may be invalidated at any
+    //! time; lock the grids in use (see UnlockGrid()), and unlock
+    //! superseded refinements, so that the final refinement can be read.
+    //! Errors encountered while refining are not reported, and the
+    //! refinement that failed is not delivered. Variables that may only
+    //! be read on the calling thread (see DerivedVar::IsThreadSafe())
+    //! are not refined: the grid returned is read at \p level and \p lod.
+    //!
+    //! \param[in] ts Time step
+    //! \param[in] varname Variable name
+    //! \param[in] level Finest grid refinement level. See DataMgr
+    //! \param[in] lod Finest level-of-detail. See DataMgr
+    //! \param[in] min Minimum extents of the region-of-interest, in user
+    //! coordinates. See GetVariable()
+    //! \param[in] max Maximum extents of the region-of-interest, in user
+    //! coordinates. See GetVariable()
+    //! \param[in] callback Function invoked with each refinement
+    //!
+    //! \retval grid The coarsest grid, or NULL on failure. The grid is
+    //! locked, and the caller must call UnlockGrid() and then delete it.
+    //! If the coarsest resolution is also the finest \p callback is
+    //! never invoked.
+    //!
+    //! \sa GetVariable(), CancelPrefetch()
+    //
+    VAPoR::Grid *GetVariableProgressive(size_t ts, string varname, int level, int lod, CoordType min, CoordType max, RefinementCallback callback);
+
+    //! \class PinSet
+    //! \brief Keep a working set of variables resident in the cache
+    //!
+    //! A PinSet locks the regions of interest of a set of variables, for
+    //! a window of time steps, in the DataMgr cache so that they are not
+    //! evicted. The window may be moved, e.g. as an animation advances,
+    //! in which case time steps leaving the window are released and time
+    //! steps entering it are read and locked. All regions are released
+    //! when the PinSet is destroyed.
+    //!
+    //! Pinned regions count against the cache size. Pinning more data
+    //! than fits in the cache causes reads to fail.
+    //!
+    //! A PinSet must be destroyed before the DataMgr it refers to.
+    //
+    class VDF_API PinSet {
+    public:
+        //! \param[in] dataMgr The DataMgr whose cache is used
+        //! \param[in] varnames Names of the variables to pin
+        //! \param[in] level Grid refinement level. See DataMgr
+        //! \param[in] lod Level-of-detail. See DataMgr
+        //! \param[in] min Minimum extents of the region-of-interest, in user
+        //! coordinates. See GetVariable()
+        //! \param[in] max Maximum extents of the region-of-interest, in user
+        //! coordinates. See GetVariable()
+        //
+        PinSet(DataMgr *dataMgr, const std::vector<string> &varnames, int level, int lod, CoordType min, CoordType max);
+        ~PinSet();
+
+        PinSet(const PinSet &) = delete;
+        PinSet &operator=(const PinSet &) = delete;
+
+        //! Pin the time steps in the range [\p ts0, \p ts1]
+        //!
+        //! Time steps outside of the range are released, and time steps
+        //! in the range that are not already pinned are read and
+        //! locked.
+        //!
+        //! \retval status A negative value is returned if any of the
+        //! variables could not be read. Time steps read successfully remain
+        //! pinned.
+        //
+        int SetTimeWindow(size_t ts0, size_t ts1);
+
+        //! Return the grids pinned for time step \p ts
+        //!
+        //! The grids are owned by the PinSet and remain valid until \p ts
+        //! leaves the time window. Returns an empty vector if \p ts is not
+        //! pinned.
+        //
+        std::vector<VAPoR::Grid *> GetGrids(size_t ts) const;
+
+        //! Release all pinned time steps
+        //
+        void Release();
+
+    private:
+        DataMgr *                                   _dataMgr;
+        std::vector<string>                         _varnames;
+        int                                         _level;
+        int                                         _lod;
+        CoordType                                   _min;
+        CoordType                                   _max;
+        std::map<size_t, std::vector<VAPoR::Grid *>> _grids;
+
+        void _release(size_t ts);
+    };
+
+    //! Enable a second level, file based, cache for evicted regions
+    //!
+    //! When enabled, regions evicted from the memory cache are written to
+    //! files in \p dir, provided that writing and reading them back is
+    //! expected to be faster than producing them again (e.g.
+    //! decompressing them, or evaluating a derived variable). The costs
+    //! of writing and reading are first estimated by timing a probe
+    //! block, and then refined as regions are spilled and read back. A
+    //! subsequent request for the region is served from the file.
+    //! Files are written after the cache lock is released, so they do
+    //! not stall other threads. Files are discarded, least recently used
+    //! first, to keep their total size under \p maxMB, and are
+    //! removed when the cache is cleared or the DataMgr is destroyed.
+    //!
+    //! \param[in] dir Directory on fast local storage in which to
+    //! create files. If empty the spill cache is disabled
+    //! \param[in] maxMB Maximum total size of files in megabytes
+    //!
+    //! \sa GetCacheStats()
+    //
+    int SetSpillCache(string dir, size_t maxMB);
+
+    //! Enable a persistent, file based cache of cell locators
+    //!
+    //! Curvilinear and unstructured grids use a spatial index of their
+    //! cells (a cell locator) for point location, which can take seconds
+    //! to build for large meshes. When enabled, a locator is stored in a
+    //! file in \p dir when it is first built, keyed by a hash of the
+    //! mesh coordinates and the subset of the mesh covered, and later
+    //! grids on the same mesh, in this or any subsequent session, load
+    //! it from the file instead of rebuilding it. Files are not removed
+    //! when the DataMgr is destroyed.
+    //!
+    //! \param[in] dir Directory in which locators are stored. If empty the
+    //! cache is disabled
+    //!
+    //! \sa LocatorCache
+    //
+    int SetLocatorCache(string dir);
+
+    //! Select the cell locator of unstructured grids
+    //!
+    //! Grids for unstructured 2D and layered meshes returned after this
+    //! call find the cell containing a point with \p locator. A bounding
+    //! volume hierarchy (UnstructuredGrid::BVH) is faster to build and
+    //! query than the default quad tree (UnstructuredGrid::QUADTREE) on
+    //! highly anisotropic meshes. Either is shared by all grids on the
+    //! same coordinates, and stored in the locator cache if enabled.
+    //!
+    //! \sa SetLocatorCache()
+    //
+    void SetCellLocator(UnstructuredGrid::CellLocator locator);
+
+    //! Memory cache eviction policies
+    //!
+    //! \li \b LRU Evict the least recently used region
+    //! \li \b GreedyDualSize Evict the region with the lowest cost to
+    //! read from the DC per byte of cache it occupies. Regions age so that
+    //! costly regions that are no longer used are eventually evicted.
+    //
+    enum EvictionPolicy { LRU, GreedyDualSize };
+
+    //! Set the memory cache eviction policy
+    //!
+    //! The policy determines which unlocked region is discarded when
+    //! space is needed in the cache. The default is GreedyDualSize, which
+    //! favors keeping regions that were expensive to produce, such
+    //! as derived variables or data reconstructed from compressed storage,
+    //! over cheaply read ones.
+    //!
+    //! \sa GetEvictionPolicy()
+    //
+    void SetEvictionPolicy(EvictionPolicy policy);
+
+    //! Return the memory cache eviction policy
+    //!
+    //! \sa SetEvictionPolicy()
+    //
+    EvictionPolicy GetEvictionPolicy() const;
+
+    //! Memory cache performance counters
+    //!
+    //! Counters are accumulated per variable until the next call to
+    //! ResetCacheStats().
+    //!
+    //! \sa GetCacheStats(), ResetCacheStats()
+    //
+    struct CacheStats {
+        size_t exactHits = 0;            // requests satisfied by an identical cached region
+        size_t containHits = 0;          // requests satisfied by a cached region containing them
+        size_t misses = 0;               // requests that required a read from the DC
+        size_t evictions = 0;            // regions evicted to make room for others
+        size_t bytesEvicted = 0;         // size of evicted regions
+        size_t bytesRead = 0;            // estimated bytes read from storage by the DC
+        size_t bytesDecompressed = 0;    // bytes returned by the DC
+        double readSeconds = 0.0;        // wall time spent reading regions from the DC
+        size_t spillHits = 0;            // requests satisfied by the spill cache
+        size_t bytesSpilled = 0;         // size of evicted regions written to the spill cache
+
+        CacheStats &operator+=(const CacheStats &rhs);
+    };
+
+    //! Return memory cache performance counters
+    //!
+    //! \param[in] varname If not empty, return counters for the named
+    //! variable only. Otherwise return the sum of the counters for all
+    //! variables
+    //!
+    //! \note \p bytesRead is estimated from the variable's compression
+    //! ratio at the requested level-of-detail, and is equal to
+    //! \p bytesDecompressed for uncompressed data
+    //
+    CacheStats GetCacheStats(string varname = "") const;
+
+    //! Return the names of the variables for which cache counters exist
+    //
+    std::vector<string> GetCacheStatsVarNames() const;
+
+    //! Reset all memory cache performance counters to zero
+    //
+    void ResetCacheStats();
+
+    //! Return memory cache performance counters as a JSON string
+    //!
+    //! The returned object contains a "total" member with the summed
+    //! counters, and a "variables" member with the counters of each
+    //! variable, along with the cache capacity and current usage
+    //! in bytes.
+    //
+    string GetCacheStatsJSON() const;
+
     //! \copydoc DC::GetNumDimensions(
     //!   string varname
     //! ) const;
@@ -676,45 +1119,98 @@ protected:
     template<typename C> class VarInfoCache {
     public:
         //
+        // Entries are identified by the time step, the variable name(s),
+        // the refinement level and lod, a key naming the attribute, and
+        // optionally a region in voxel coordinates
         //
-        void Set(size_t ts, std::vector<string> varnames, int level, int lod, string key, const std::vector<C> &values);
+        void Set(size_t ts, const std::vector<string> &varnames, int level, int lod, const string &key, const std::vector<C> &values)
+        {
+            _set(_make_key(ts, _id(varnames), level, lod, key), values);
+        }
 
-        void Set(size_t ts, string varname, int level, int lod, string key, const std::vector<C> &values)
+        void Set(size_t ts, const string &varname, int level, int lod, const string &key, const std::vector<C> &values) { _set(_make_key(ts, _id(varname), level, lod, key), values); }
+
+        void Set(size_t ts, const string &varname, int level, int lod, const string &key, const DimsType &min, const DimsType &max, const std::vector<C> &values)
         {
-            std::vector<string> varnames;
-            varnames.push_back(varname);
-            Set(ts, varnames, level, lod, key, values);
+            _set(_make_key(ts, _id(varname), level, lod, key, min, max), values);
         }
 
-        bool Get(size_t ts, std::vector<string> varnames, int level, int lod, string key, std::vector<C> &values) const;
+        bool Get(size_t ts, const std::vector<string> &varnames, int level, int lod, const string &key, std::vector<C> &values) const
+        {
+            return (_get(_make_key(ts, _id(varnames), level, lod, key), values));
+        }
 
-        bool Get(size_t ts, string varname, int level, int lod, string key, std::vector<C> &values) const
+        bool Get(size_t ts, const string &varname, int level, int lod, const string &key, std::vector<C> &values) const
         {
-            std::vector<string> varnames;
-            varnames.push_back(varname);
-            return Get(ts, varnames, level, lod, key, values);
+            return (_get(_make_key(ts, _id(varname), level, lod, key), values));
         }
 
-        void Purge(size_t ts, std::vector<string> varnames, int level, int lod, string key);
-        void Purge(size_t ts, string varname, int level, int lod, string key)
+        bool Get(size_t ts, const string &varname, int level, int lod, const string &key, const DimsType &min, const DimsType &max, std::vector<C> &values) const
         {
-            std::vector<string> varnames;
-            varnames.push_back(varname);
-            Purge(ts, varnames, level, lod, key);
+            return (_get(_make_key(ts, _id(varname), level, lod, key, min, max), values));
         }
-        void Purge(std::vector<string> varnames);
 
-        void Clear() { _cache.clear(); }
+        void Purge(size_t ts, const std::vector<string> &varnames, int level, int lod, const string &key);
+        void Purge(size_t ts, const string &varname, int level, int lod, const string &key) { Purge(ts, std::vector<string>(1, varname), level, lod, key); }
 
-        static string _make_hash(string key, size_t ts, std::vector<string> cvars, int level, int lod);
+        // Purge all entries for exactly the variables varnames
+        //
+        void Purge(const std::vector<string> &varnames);
 
-        void _decode_hash(const string &hash, string &key, size_t &ts, vector<string> &varnames, int &level, int &lod);
+        void Clear();
 
     private:
-        std::map<string, std::vector<C>> _cache;
+        // Variable names and attribute keys are interned so that cache
+        // keys are fixed size and cheap to hash and compare
+        //
+        struct key_t {
+            size_t   ts;
+            size_t   varsid;
+            size_t   keyid;
+            int      level;
+            int      lod;
+            DimsType min;
+            DimsType max;
+
+            bool operator==(const key_t &rhs) const
+            {
+                return (ts == rhs.ts && varsid == rhs.varsid && keyid == rhs.keyid && level == rhs.level && lod == rhs.lod && min == rhs.min && max == rhs.max);
+            }
+        };
+
+        struct key_hash_t {
+            size_t operator()(const key_t &key) const;
+        };
+
+        // Entries are spread over independently locked shards so that
+        // concurrent callers rarely contend
+        //
+        static const int _nshards = 16;
+        struct shard_t {
+            std::unordered_map<key_t, std::vector<C>, key_hash_t> cache;
+            mutable std::mutex                                    mutex;
+        };
+        mutable shard_t _shards[_nshards];
+
+        mutable std::unordered_map<string, size_t> _ids;
+        mutable std::shared_mutex                  _idsMutex;
+
+        size_t _id(const string &name) const;
+        size_t _id(const std::vector<string> &names) const;
+
+        key_t _make_key(size_t ts, size_t varsid, int level, int lod, const string &key, const DimsType &min = {{0, 0, 0}}, const DimsType &max = {{0, 0, 0}}) const
+        {
+            return (key_t{ts, varsid, _id(key), level, lod, min, max});
+        }
+
+        shard_t &_shard(const key_t &key) const { return (_shards[key_hash_t()(key) % _nshards]); }
+
+        void _set(const key_t &key, const std::vector<C> &values);
+        bool _get(const key_t &key, std::vector<C> &values) const;
     };
 
     mutable std::map<std::pair<VarType, size_t>, std::vector<string>> _dataVarNamesCache;
+    mutable std::mutex                                                _dataVarNamesCacheMutex;
 
     string _format;
     int    _nthreads;
@@ -727,26 +1223,139 @@ protected:
     DerivedVarMgr _dvm;
     bool          _doTransformHorizontal;
     bool          _doTransformVertical;
-    string        _openVarName;
+
+    // Names of the variables opened by _openVariableRead(), innermost
+    // last. Reading a derived variable may open other variables
+    //
+    vector<string> _openVarNames;
 
     std::vector<double> _timeCoordinates;
     string              _proj4String;
     string              _proj4StringDefault;
     DimsType            _bs;
 
+    // Key uniquely identifying a cached region. Variable names are
+    // interned (see _varNameId()) so that keys are cheap to hash and compare
+    //
+    struct region_key_t {
+        size_t   ts;
+        size_t   varid;
+        int      level;
+        int      lod;
+        DimsType bmin;
+        DimsType bmax;
+
+        bool operator==(const region_key_t &rhs) const
+        {
+            return (ts == rhs.ts && varid == rhs.varid && level == rhs.level && lod == rhs.lod && bmin == rhs.bmin && bmax == rhs.bmax);
+        }
+    };
+
+    struct region_key_hash_t {
+        size_t operator()(const region_key_t &key) const;
+    };
+
     typedef struct {
-        size_t              ts;
-        string              varname;
-        int                 level;
-        int                 lod;
-        DimsType            bmin;
-        DimsType            bmax;
-        int                 lock_counter;
-        void *              blks;
+        region_key_t key;
+        string       varname;
+        int          lock_counter;
+        bool         loading;    // blocks are being read from the file system
+        void *       blks;
+        size_t       nbytes;      // size of blks
+        double       cost;        // seconds taken to read blks from the DC
+        double       priority;    // eviction priority, lowest is evicted first
     } region_t;
 
-    // a list of all allocated regions
+    typedef std::list<region_t>::iterator region_itr_t;
+
+    // Unlocked regions, ordered from least (front) to most (back) recently
+    // used. Locked regions are spliced onto _lockedRegionsList so that
+    // the least recently used, evictable region is always at the front
+    // of _regionsList.
+    //
     std::list<region_t> _regionsList;
+    std::list<region_t> _lockedRegionsList;
+
+    // Unlocked regions ordered by eviction priority, identified by their
+    // blocks, for the GreedyDualSize policy. _evictionAge is the
+    // priority of the most recently evicted region
+    //
+    std::set<std::pair<double, const void *>> _regionsPriority;
+    EvictionPolicy                            _evictionPolicy;
+    double                                    _evictionAge;
+
+    // Second level cache for evicted regions. _spillSecondsPerByte is a
+    // running estimate of the cost of reading a region back from it,
+    // and _spillWriteSecondsPerByte of writing one to it. Both are
+    // seeded by SetSpillCache(). _fingerprint identifies the data set in
+    // spilled region keys
+    //
+    SpillCache _spillCache;
+    double     _spillSecondsPerByte;
+    double     _spillWriteSecondsPerByte;
+    string     _fingerprint;
+
+    // Copies of evicted regions waiting to be written to _spillCache.
+    // Queued by _evict_region() with _regionsMutex held, and written by
+    // _flush_spills() once it is released. _spillMutex is held while
+    // they are written, and when the spill cache is purged, so that a
+    // purge never misses a region being written
+    //
+    struct spill_t {
+        string                           key;
+        string                           varname;
+        std::unique_ptr<unsigned char[]> data;
+        size_t                           nbytes;
+    };
+    std::vector<spill_t> _pendingSpills;
+    std::mutex           _spillMutex;
+
+    // Indices into the two region lists above. List iterators remain valid
+    // when regions are spliced between lists
+    //
+    std::unordered_map<region_key_t, region_itr_t, region_key_hash_t> _regionsIndex;
+    std::unordered_map<const void *, region_itr_t>                    _regionsBlksIndex;
+
+    // Regions grouped by time step, variable, level, and lod, irrespective
+    // of their spatial extents. Used to find a cached region that contains
+    // a requested region when there is no exact match.
+    //
+    std::unordered_map<region_key_t, std::vector<region_itr_t>, region_key_hash_t> _regionsGroupIndex;
+
+    // Regions currently being read from the file system. A thread
+    // requesting a region that is in flight waits on its latch rather
+    // than issuing a second read. The latch's value is true if the read
+    // succeeded.
+    //
+    std::unordered_map<region_key_t, std::shared_future<bool>, region_key_hash_t> _loadingRegions;
+
+    // Regions allocated by threads extracting a time series (see
+    // GetTimeSeries()), whatever the variable they belong to, so that
+    // they may be demoted once sampled
+    //
+    std::map<std::thread::id, std::vector<region_key_t>> _transientRegions;
+
+    // Protects the region lists and indices, _loadingRegions,
+    // _transientRegions, _blk_mem_mgr, and the locked block maps. Unless
+    // otherwise noted the private region methods expect the caller to
+    // hold it exclusively.
+    //
+    mutable std::shared_mutex _regionsMutex;
+
+    // Serializes all access to the DC, reads and metadata queries alike,
+    // and reads of derived variables, none of which is thread safe. A
+    // thread takes it before announcing a read in _loadingRegions.
+    // Lock order: _readMutex, _spillMutex, _regionsMutex
+    //
+    mutable std::recursive_mutex _readMutex;
+
+    // Cache performance counters by variable name. Protected by
+    // _regionsMutex
+    //
+    std::map<string, CacheStats> _cacheStats;
+
+    mutable std::unordered_map<string, size_t> _varNameIds;
+    mutable std::mutex                         _varNameIdsMutex;
 
     VAPoR::BlkMemMgr *_blk_mem_mgr;
 
@@ -756,7 +1365,66 @@ protected:
     mutable VarInfoCache<double> _varInfoCacheDouble;
     mutable VarInfoCache<void *> _varInfoCacheVoidPtr;
 
-    std::map<string, BlkExts> _blkExtsCache;
+    std::unordered_map<region_key_t, BlkExts, region_key_hash_t> _blkExtsCache;
+    std::mutex                                                 _blkExtsCacheMutex;
+
+    // Per-block value ranges of variables, indexed by the region key of
+    // the time step, variable, level and lod. Blocks include a one-voxel
+    // halo on their upper faces. Ranges are filled in from DC metadata,
+    // or from the data as regions are read
+    //
+    struct blkRanges_t {
+        string              varname;
+        DimsType            bdims = {{1, 1, 1}};
+        std::vector<double> mins;
+        std::vector<double> maxs;
+        std::vector<bool>   known;
+    };
+    std::unordered_map<region_key_t, blkRanges_t, region_key_hash_t> _blkRangesCache;
+    std::mutex                                                     _blkRangesCacheMutex;
+
+    // Progress of a GetVariableProgressive() request, shared by its
+    // queued refinements. delivered is the step of the finest
+    // refinement passed to the callback so far. Protected by
+    // _refineMutex
+    //
+    struct refinement_t {
+        int                nsteps = 0;
+        int                delivered = 0;
+        RefinementCallback callback;
+    };
+
+    // Queued Prefetch() requests, serviced by _prefetchThreads. Requests
+    // queued by GetVariableProgressive() have a refinement. generation
+    // is the value of _prefetchGeneration when the request was queued
+    //
+    struct prefetch_t {
+        size_t                        ts;
+        string                        varname;
+        int                           level;
+        int                           lod;
+        CoordType                     min;
+        CoordType                     max;
+        int                           step = 0;
+        size_t                        generation = 0;
+        std::shared_ptr<refinement_t> refinement;
+    };
+
+    std::deque<prefetch_t>   _prefetchQueue;
+    std::vector<std::thread> _prefetchThreads;
+    std::mutex               _prefetchMutex;
+    std::condition_variable  _prefetchCV;
+    std::condition_variable  _prefetchIdleCV;
+    size_t                   _prefetchActive;
+    bool                     _prefetchShutdown;
+
+    // Held while a refinement is checked and delivered. CancelPrefetch()
+    // advances _prefetchGeneration while holding both it and
+    // _prefetchMutex, in that order, so that refinements requested
+    // before the cancellation are discarded when they complete
+    //
+    std::recursive_mutex _refineMutex;
+    size_t               _prefetchGeneration;
 
     std::map<const Grid *, vector<float *>> _lockedFloatBlks;
     std::map<const Grid *, vector<int *>>   _lockedIntBlks;
@@ -770,6 +1438,12 @@ protected:
     //
     std::vector<string> _get_var_dependencies_all(std::vector<string> varnames, std::vector<string> dependencies) const;
 
+    // Return false if any of the variables, or their dependencies, is a
+    // derived variable that may only be read on the calling thread. See
+    // DerivedVar::IsThreadSafe()
+    //
+    bool _isThreadSafe(const std::vector<string> &varnames) const;
+
     // Return true if native data has a transformable horizontal coordinate
     //
     bool _hasHorizontalXForm() const;
@@ -811,6 +1485,40 @@ protected:
 
     int _find_bounding_grid(size_t ts, string varname, int level, int lod, CoordType min, CoordType max, DimsType &min_ui, DimsType &max_ui);
 
+    // Return true if the unstructured variable varname can be read as a
+    // sub-mesh covering a range of its node dimension
+    //
+    bool _sub_mesh_supported(string varname) const;
+
+    // Find the range of node indices of the faces of the unstructured
+    // variable varname that intersect the horizontal extents of the box
+    // bounded by min and max. Returns 1 if no faces intersect. N.B. reads
+    // the coordinates and connectivity of the entire mesh
+    //
+    int _find_bounding_sub_mesh(size_t ts, string varname, int level, int lod, const CoordType &min, const CoordType &max, DimsType &min_ui, DimsType &max_ui);
+
+    // Return a locked cache region containing the connectivity of the
+    // sub-mesh formed by the faces whose nodes all lie in the node index
+    // range [n0, n1]. The region holds the number of faces in the
+    // sub-mesh followed by a compacted copy of each connectivity variable
+    // in conn_varnames. Node and face references are relative to the
+    // sub-mesh, with an offset of zero. N.B. the connectivity variables
+    // of the entire mesh are read to build it
+    //
+    int *_get_sub_mesh(size_t ts, string varname, int level, int lod, const vector<string> &conn_varnames, const vector<DimsType> &conn_dimsvec, const vector<DimsType> &conn_bsvec,
+                       const vector<DimsType> &conn_bminvec, const vector<DimsType> &conn_bmaxvec, size_t nodeBlkMin, size_t nodeBlkMax, size_t n0, size_t n1, const DimsType &faceDims,
+                       size_t maxVertexPerFace, size_t maxFacePerVertex, long vertexOffset, long faceOffset);
+
+    // Get the ranges of the regions of a variable bounded by the voxel
+    // coordinates mins[i] and maxs[i] from metadata stored by the DC.
+    // ranges holds the min and max of each region, in turn. Returns
+    // 1 on success, 0 if no metadata are available
+    //
+    int _getDataRangesFromMetadata(size_t ts, string varname, int level, int lod, const vector<DimsType> &mins, const vector<DimsType> &maxs, vector<double> &ranges);
+
+    template<typename T>
+    void _update_blk_ranges(size_t ts, string varname, int level, int lod, const DimsType &grid_dims, const DimsType &grid_bs, const DimsType &grid_bmin, const DimsType &grid_bmax, const T *blks);
+
     void _setupCoordVecsHelper(string data_varname, const DimsType &data_dimlens, const DimsType &data_bmin, const DimsType &data_bmax, string coord_varname, int order, DimsType &coord_dimlens,
                                DimsType &coord_bmin, DimsType &coord_bmax, bool structured, long ts) const;
 
@@ -824,35 +1532,75 @@ protected:
 
     VAPoR::Grid *_getVariable(size_t ts, string varname, int level, int lod, DimsType min, DimsType max, bool lock, bool dataless);
 
+    template<typename T> int _getVariables(size_t ts, const std::vector<string> &varnames, int level, int lod, const T &min, const T &max, bool lock, std::vector<VAPoR::Grid *> &grids);
+
     int _parseOptions(vector<string> &options);
 
-    template<typename T> T *_get_region_from_cache(size_t ts, string varname, int level, int lod, const DimsType &bmin, const DimsType &bmax, bool lock);
+    template<typename T>
+    T *_get_region_from_cache(size_t ts, string varname, int level, int lod, const DimsType &bmin, const DimsType &bmax, bool lock, bool contain, DimsType &rbmin, DimsType &rbmax);
 
     template<typename T>
-    int _get_unblocked_region_from_fs(size_t ts, string varname, int level, int lod, const DimsType &grid_dims, const DimsType &grid_bs, const DimsType &grid_min, const DimsType &grid_max, T *blks);
+    int _get_unblocked_region_from_fs(size_t ts, string varname, int level, int lod, const DimsType &grid_dims, const DimsType &grid_bs, const DimsType &grid_min, const DimsType &grid_max, T *blks,
+                                      size_t &nbytes);
 
     template<typename T>
     int _get_blocked_region_from_fs(size_t ts, string varname, int level, int lod, const DimsType &file_bs, const DimsType &file_dims, const DimsType &grid_dims, const DimsType &grid_bs,
-                                    const DimsType &grid_min, const DimsType &grid_max, T *blks);
+                                    const DimsType &grid_min, const DimsType &grid_max, T *blks, size_t &nbytes);
 
     template<typename T>
     T *_get_region_from_fs(size_t ts, string varname, int level, int lod, const DimsType &grid_dims, const DimsType &grid_bs, const DimsType &grid_bmin, const DimsType &grid_bmax, bool lock);
 
-    template<typename T> T *_get_region(size_t ts, string varname, int level, int lod, int nlods, const DimsType &dims, const DimsType &bs, const DimsType &bmin, const DimsType &bmax, bool lock);
+    template<typename T>
+    T *_get_region(size_t ts, string varname, int level, int lod, int nlods, const DimsType &dims, const DimsType &bs, const DimsType &bmin, const DimsType &bmax, bool lock, bool contain,
+                   DimsType &rbmin, DimsType &rbmax);
 
     template<typename T>
-    int _get_regions(size_t ts, const std::vector<string> &varnames, int level, int lod, bool lock, const std::vector<DimsType> &dimsvec, const std::vector<DimsType> &bsvec,
-                     const std::vector<DimsType> &bminvec, const std::vector<DimsType> &bmaxvec, std::vector<T *> &blkvec);
+    int _get_regions(size_t ts, const std::vector<string> &varnames, int level, int lod, bool lock, bool contain, const std::vector<DimsType> &dimsvec, const std::vector<DimsType> &bsvec,
+                     const std::vector<DimsType> &bminvec, const std::vector<DimsType> &bmaxvec, std::vector<T *> &blkvec, std::vector<DimsType> &rbminvec, std::vector<DimsType> &rbmaxvec);
 
     void _unlock_blocks(const void *blks);
 
+    void _prefetchWorker();
+    void _refine(const prefetch_t &p);
+
+    // Wait until the prefetch threads have finished the requests they
+    // are servicing
+    //
+    void _waitPrefetchIdle();
+    void _stopPrefetch();
+
+    size_t _varNameId(const string &varname) const;
+
+    region_key_t _make_region_key(size_t ts, const string &varname, int level, int lod, const DimsType &bmin, const DimsType &bmax) const;
+
+    void _erase_region(region_itr_t itr);
+
     std::vector<string> _get_native_variables() const;
 
     void *_alloc_region(size_t ts, string varname, int level, int lod, DimsType bmin, DimsType bmax, DimsType bs, int element_sz, bool lock, bool fill);
 
     void _free_region(size_t ts, string varname, int level, int lod, DimsType bmin, DimsType bmax, bool forceFlag = false);
 
-    bool _free_lru();
+    // Make a region an eviction candidate, or update its priority if it
+    // already is one
+    //
+    void _set_evictable(region_itr_t itr);
+
+    bool _evict_region();
+
+    // Make a cached, unlocked region the next to be evicted
+    //
+    void _demote_region(const region_key_t &key);
+
+    int _sampleAtPoints(size_t ts, string varname, int level, int lod, const std::vector<CoordType> &points, float *values, int nthreads);
+
+    string _spill_key(const region_t &region) const;
+
+    // Write the regions queued by _evict_region() to the spill cache.
+    // Must be called without _regionsMutex held
+    //
+    void _flush_spills();
+
     void _free_var(string varname);
 
     int _level_correction(string varname, int &level) const;
@@ -243,6 +243,37 @@ VDF_API bool GetFirstExistingVariable(DataMgr *dataMgr, int level, int lod, int
 //
 VDF_API bool GetFirstExistingVariable(DataMgr *dataMgr, size_t ts, int level, int lod, int ndim, string &varname);
 
+//! Extract the connectivity of a sub-mesh of an unstructured mesh
+//!
+//! The sub-mesh is formed by the faces of the mesh whose nodes all lie
+//! in the node index range [\p n0, \p n1]. Node references in the
+//! sub-mesh are relative to \p n0, and face references are indices of
+//! faces in the sub-mesh; both have an offset of zero. References to
+//! faces outside of the sub-mesh become boundary references (-2).
+//! Missing (-1) and boundary references are preserved.
+//!
+//! \param[in] faceNode Face-node connectivity of the mesh, with
+//! \p maxVertexPerFace entries per face
+//! \param[in] nodeFace Node-face connectivity of the mesh, with
+//! \p maxFacePerVertex entries per node, or NULL
+//! \param[in] faceFace Face-face connectivity of the mesh, with
+//! \p maxVertexPerFace entries per face, or NULL
+//! \param[in] nfaces Number of faces in the mesh
+//! \param[in] vertexOffset Offset added to node references of
+//! the mesh to obtain zero based node indices
+//! \param[in] faceOffset Offset added to face references of
+//! the mesh to obtain zero based face indices
+//! \param[out] subFaceNode Face-node connectivity of the sub-mesh
+//! \param[out] subNodeFace Node-face connectivity of the sub-mesh, for
+//! nodes \p n0 through \p n1. Empty if \p nodeFace is NULL
+//! \param[out] subFaceFace Face-face connectivity of the sub-mesh.
+//! Empty if \p faceFace is NULL
+//!
+//! \retval nfaces The number of faces in the sub-mesh
+//
+VDF_API size_t MakeSubMesh(const int *faceNode, const int *nodeFace, const int *faceFace, size_t nfaces, size_t maxVertexPerFace, size_t maxFacePerVertex, long vertexOffset, long faceOffset,
+                           size_t n0, size_t n1, std::vector<int> &subFaceNode, std::vector<int> &subNodeFace, std::vector<int> &subFaceFace);
+
 #ifdef VAPOR3_0_0_ALPHA
 
 //! Determine the size of a voxel in user coordinates, along a specific dimension,
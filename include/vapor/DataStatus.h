@@ -156,6 +156,23 @@ public:
     //
     void SetCacheSize(size_t sizeMB) { _cacheSize = sizeMB; }
 
+    //! Select the cell locator of unstructured grids
+    //!
+    //! Has no effect until the next data set is loaded.
+    //!
+    //! \sa DataMgr::SetCellLocator()
+    //
+    void SetCellLocator(UnstructuredGrid::CellLocator locator) { _cellLocator = locator; }
+
+    //! Set the directory of the persistent cell locator cache
+    //!
+    //! If \p dir is empty, the default, the cache is disabled. Has no
+    //! effect until the next data set is loaded.
+    //!
+    //! \sa DataMgr::SetLocatorCache()
+    //
+    void SetLocatorCache(string dir) { _locatorCacheDir = dir; }
+
     string GetMapProjection() const;
     string GetMapProjectionDefault(string dataSetName) const;
 
@@ -193,14 +210,16 @@ private:
 
 #ifndef DOXYGEN_SKIP_THIS
 
-    size_t                      _cacheSize;
-    int                         _nThreads;
-    map<string, DataMgr *>      _dataMgrs;
-    map<string, vector<size_t>> _timeMap;
-    vector<double>              _timeCoords;
-    vector<string>              _timeCoordsFormatted;
-    bool                        _isDataCacheDirty;
-    bool                        _wasCacheDirty;
+    size_t                        _cacheSize;
+    int                           _nThreads;
+    UnstructuredGrid::CellLocator _cellLocator;
+    string                        _locatorCacheDir;
+    map<string, DataMgr *>        _dataMgrs;
+    map<string, vector<size_t>>   _timeMap;
+    vector<double>                _timeCoords;
+    vector<string>                _timeCoordsFormatted;
+    bool                          _isDataCacheDirty;
+    bool                          _wasCacheDirty;
 
 #endif    // DOXYGEN_SKIP_THIS
 
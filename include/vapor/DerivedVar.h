@@ -84,6 +84,13 @@ public:
 
     virtual bool VariableExists(size_t ts, int reflevel, int lod) const = 0;
 
+    //! Return true if the variable may be read from any thread. Variables
+    //! that can only be computed on the application's main thread (e.g.
+    //! by the embedded Python interpreter) return false, and are never
+    //! read by the DataMgr's worker threads
+    //!
+    virtual bool IsThreadSafe() const { return (true); }
+
 protected:
     string        _derivedVarName;
     DC::FileTable _fileTable;
@@ -272,6 +272,25 @@ public:
         return (GetValue(coords));
     }
 
+    //! Reconstruct the scalar field at many points
+    //!
+    //! This method is equivalent to calling GetValue() for each of
+    //! \p n points, and returns identical results. Derived classes may
+    //! override it to amortize per point overhead (virtual dispatch, cell
+    //! location, block addressing) across the batch. Batches of spatially
+    //! coherent points (e.g. along a line or across a plane) benefit most.
+    //!
+    //! \param[in] xyz An array of 3 * \p n interleaved point coordinates
+    //! (x0, y0, z0, x1, y1, z1, ...). The Z coordinate is ignored if the
+    //! geometry dimension is 2.
+    //! \param[in] n The number of points
+    //! \param[out] values An array of \p n elements that will contain the
+    //! value reconstructed at each point
+    //!
+    //! \sa GetValue()
+    //!
+    virtual void GetValues(const double *xyz, size_t n, float *values) const;
+
     //! Return the extents of the user coordinate system
     //!
     //! This pure virtual method returns min and max extents of
@@ -506,6 +525,30 @@ public:
     //!
     virtual bool GetIndicesCell(const CoordType &coords, DimsType &indices) const = 0;
 
+    //! Return the indices of the cell containing the
+    //! specified user coordinates, starting the search at a hint cell
+    //!
+    //! This method behaves exactly like GetIndicesCell(coords, indices),
+    //! but grids whose point location is expensive may use \p hintCell
+    //! as the starting point of the search. Callers that issue
+    //! spatially coherent queries should pass the cell returned by the
+    //! previous query. A hint that is out of range (e.g. with index
+    //! values of std::numeric_limits<size_t>::max()) is ignored.
+    //!
+    //! The default implementation ignores the hint.
+    //!
+    //! \param[in] coords User coordinates of the point
+    //! \param[in] hintCell Indices of a cell likely to contain, or be near,
+    //! the point
+    //! \param[out] indices Indices of the cell containing \p coords
+    //!
+    //! \retval status true on success, false if the point is not contained
+    //! by any cell.
+    //!
+    //! \sa GetIndicesCell()
+    //!
+    virtual bool GetIndicesCell(const CoordType &coords, const DimsType &hintCell, DimsType &indices) const { return (GetIndicesCell(coords, indices)); }
+
     //! \deprecated
     //
     virtual bool GetIndicesCell(const double coords[3], size_t indices[3]) const
@@ -1269,6 +1312,14 @@ protected:
 
     float TrilinearInterpolate(size_t i, size_t j, size_t k, const double xwgt, const double ywgt, const double zwgt) const;
 
+    // Same as TrilinearInterpolate(), but the cell's corner values are
+    // read directly from block storage with a single block lookup when
+    // the cell doesn't straddle a block boundary. Cells with missing
+    // values, or on grids with an X or Y dimension of length one, are
+    // handed to TrilinearInterpolate()
+    //
+    float TrilinearInterpolateBlocked(size_t i, size_t j, size_t k, const double xwgt, const double ywgt, const double zwgt) const;
+
 private:
     DimsType             _dims;                   // dimensions of grid arrays
     DimsType             _bs = {{1, 1, 1}};       // dimensions of each block
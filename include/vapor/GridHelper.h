@@ -1,6 +1,12 @@
 #include <vector>
 #include <unordered_map>
 #include <list>
+#include <mutex>
+#include <map>
+#include <set>
+#include <memory>
+#include <condition_variable>
+#include <atomic>
 #include <cstddef>
 #include <stdexcept>
 #include <vapor/DC.h>
@@ -11,6 +17,7 @@
 #include <vapor/StretchedGrid.h>
 #include <vapor/UnstructuredGrid2D.h>
 #include <vapor/UnstructuredGridLayered.h>
+#include <vapor/LocatorCache.h>
 
 #ifndef GRIDMGR_H
     #define GRIDMGR_H
@@ -21,7 +28,7 @@ class UnstructuredGrid3D;
 
 class VDF_API GridHelper : public Wasp::MyBase {
 public:
-    GridHelper(size_t max_size = 10) : _qtrCache(max_size) {}
+    GridHelper(size_t max_size = 10) : _qtrCache(max_size), _bvhCache(max_size), _cellLocator(UnstructuredGrid::QUADTREE) {}
 
     ~GridHelper();
 
@@ -37,10 +44,13 @@ public:
     //	bsvec: data block dimensions, and coordinate block dimensions
     //  bminvec: ROI offsets in blocks, full domain, data and coordinates
     //  bmaxvec: ROI offsets in blocks, full domain, data and coordinates
+    //  rbminvec: offsets in blocks of the cached regions stored in blkvec.
+    //  Each region must contain the ROI specified by bminvec and bmaxvec
+    //  rbmaxvec: offsets in blocks of the cached regions stored in blkvec
     //
     StructuredGrid *MakeGridStructured(string gridType, size_t ts, int level, int lod, const DC::DataVar &var, const std::vector<DC::CoordVar> &cvarsinfo, const DimsType &roi_dims,
                                        const DimsType &dims, const std::vector<float *> &blkvec, const std::vector<DimsType> &bsvec, const std::vector<DimsType> &bminvec,
-                                       const std::vector<DimsType> &bmaxvec);
+                                       const std::vector<DimsType> &bmaxvec, const std::vector<DimsType> &rbminvec, const std::vector<DimsType> &rbmaxvec);
 
     UnstructuredGrid *MakeGridUnstructured(string gridType, size_t ts, int level, int lod, const DC::DataVar &var, const std::vector<DC::CoordVar> &cvarsinfo, const DimsType &roi_dims,
                                            const DimsType &dims, const std::vector<float *> &blkvec, const std::vector<DimsType> &bsvec, const std::vector<DimsType> &bminvec,
@@ -48,7 +58,32 @@ public:
                                            const std::vector<DimsType> &conn_bminvec, const std::vector<DimsType> &conn_bmaxvec, const DimsType &vertexDims, const DimsType &faceDims,
                                            const DimsType &edgeDims, UnstructuredGrid::Location location, size_t maxVertexPerFace, size_t maxFacePerVertex, long vertexOffset, long faceOffset);
 
+    //! Enable a persistent, file based cache of cell locators
+    //!
+    //! \param[in] dir Directory in which locators are stored. If empty the
+    //! cache is disabled
+    //!
+    //! \sa LocatorCache
+    //
+    int SetLocatorCache(string dir) { return (_locatorCache.Initialize(dir)); }
+
+    //! Select the cell locator of unstructured 2D and layered grids
+    //!
+    //! Grids made after this call find the cell containing a point with
+    //! \p locator. Like quad trees, bounding volume hierarchies are shared
+    //! by grids built on the same coordinates, and stored in the locator
+    //! cache if it is enabled. The default is UnstructuredGrid::QUADTREE.
+    //!
+    //! \sa UnstructuredGrid2D::SetBVHRectangle()
+    //
+    void SetCellLocator(UnstructuredGrid::CellLocator locator) { _cellLocator = locator; }
+
+    UnstructuredGrid::CellLocator GetCellLocator() const { return (_cellLocator); }
+
 private:
+    // Thread safe: GridHelper may be used by concurrent DataMgr::GetVariable()
+    // calls
+    //
     template<typename key_t, typename value_t> class lru_cache {
     public:
         typedef typename std::pair<key_t, value_t>             key_value_pair_t;
@@ -60,6 +95,8 @@ private:
 
         value_t put(const key_t &key, value_t value)
         {
+            std::lock_guard<std::mutex> guard(_mutex);
+
             value_t rvalue = NULL;
             auto    it = _cache_items_map.find(key);
             _cache_items_list.push_front(key_value_pair_t(key, value));
@@ -82,6 +119,8 @@ private:
 
         value_t get(const key_t &key)
         {
+            std::lock_guard<std::mutex> guard(_mutex);
+
             auto it = _cache_items_map.find(key);
             if (it == _cache_items_map.end()) return (NULL);
 
@@ -91,6 +130,8 @@ private:
 
         value_t remove_lru()
         {
+            std::lock_guard<std::mutex> guard(_mutex);
+
             if (!_cache_items_map.size()) return (NULL);
 
             auto last = _cache_items_list.end();
@@ -110,20 +151,57 @@ private:
         std::list<key_value_pair_t>                _cache_items_list;
         std::unordered_map<key_t, list_iterator_t> _cache_items_map;
         size_t                                     _max_size;
+        std::mutex                                 _mutex;
     };
 
+    // Cell locators are shared by all grids built on the same coordinate
+    // region. _qtrCache holds the most recently used locators, and _qtrLive
+    // tracks every locator that is still referenced by a grid so that it
+    // can be reused after it has been dropped from _qtrCache. _bvhCache and
+    // _bvhLive do the same for bounding volume hierarchies. _qtrBuilding
+    // contains the keys of locators of either kind currently being
+    // constructed
+    //
     lru_cache<string, std::shared_ptr<const QuadTreeRectangleP>> _qtrCache;
+    std::map<string, std::weak_ptr<const QuadTreeRectangleP>>    _qtrLive;
+    lru_cache<string, std::shared_ptr<const BVHRectangle>>       _bvhCache;
+    std::map<string, std::weak_ptr<const BVHRectangle>>          _bvhLive;
+    std::set<string>                                             _qtrBuilding;
+    std::mutex                                                   _qtrMutex;
+    std::condition_variable                                      _qtrBuilt;
+
+    // Holds the claim on a key returned by _getQuadTreeRectangle() or
+    // _getBVHRectangle() and releases it when it goes out of scope, so
+    // that threads waiting for the locator are woken even if constructing
+    // it fails or throws. An empty key holds no claim
+    //
+    class qtrClaim_t {
+    public:
+        qtrClaim_t(GridHelper *gh, const string &key) : _gh(gh), _key(key) {}
+        ~qtrClaim_t();
+        qtrClaim_t(const qtrClaim_t &) = delete;
+        qtrClaim_t &operator=(const qtrClaim_t &) = delete;
+
+    private:
+        GridHelper *_gh;
+        string      _key;
+    };
+
+    // Locators not found in memory are looked up here, by a fingerprint of
+    // their mesh, before being built
+    //
+    LocatorCache _locatorCache;
 
-    RegularGrid *_make_grid_regular(const DimsType &dims, const std::vector<float *> &blkvec, const DimsType &bs, const DimsType &bmin, const DimsType &bmax
+    std::atomic<UnstructuredGrid::CellLocator> _cellLocator;
 
-    ) const;
+    RegularGrid *_make_grid_regular(const DimsType &dims, const std::vector<std::vector<float *>> &blkptrsvec, const DimsType &bs) const;
 
-    StretchedGrid *_make_grid_stretched(const DimsType &dims, const std::vector<float *> &blkvec, const DimsType &bs, const DimsType &bmin, const DimsType &bmax) const;
+    StretchedGrid *_make_grid_stretched(const DimsType &dims, const std::vector<std::vector<float *>> &blkptrsvec, const DimsType &bs) const;
 
-    LayeredGrid *_make_grid_layered(const DimsType &dims, const std::vector<float *> &blkvec, const DimsType &bs, const DimsType &bmin, const DimsType &bmax) const;
+    LayeredGrid *_make_grid_layered(const DimsType &dims, const std::vector<std::vector<float *>> &blkptrsvec, const DimsType &bs) const;
 
-    CurvilinearGrid *_make_grid_curvilinear(size_t ts, int level, int lod, const std::vector<DC::CoordVar> &cvarsinfo, const DimsType &dims, const std::vector<float *> &blkvec, const DimsType &bs,
-                                            const DimsType &bmin, const DimsType &bmax);
+    CurvilinearGrid *_make_grid_curvilinear(size_t ts, int level, int lod, const std::vector<DC::CoordVar> &cvarsinfo, const DimsType &dims, const std::vector<std::vector<float *>> &blkptrsvec,
+                                            const DimsType &bs, const DimsType &bmin, const DimsType &bmax);
 
     UnstructuredGrid2D *_make_grid_unstructured2d(size_t ts, int level, int lod, const DC::DataVar &var, const std::vector<DC::CoordVar> &cvarsinfo, const DimsType &dims,
                                                   const std::vector<float *> &blkvec, const DimsType &bs, const DimsType &bmin, const DimsType &bmax, const std::vector<int *> &conn_blkvec,
@@ -143,6 +221,26 @@ private:
 
     void _makeGridHelper(const DC::DataVar &var, const DimsType &roi_dims, const DimsType &dims, Grid *g) const;
 
+    // Return the locator for key. If none exists, and no other thread is
+    // constructing it, returns NULL and the caller must construct one and
+    // pass it to _putQuadTreeRectangle(), holding a qtrClaim_t for key
+    // until it has done so. Otherwise waits for the thread constructing it
+    //
+    std::shared_ptr<const QuadTreeRectangleP> _getQuadTreeRectangle(const string &key);
+
+    void _putQuadTreeRectangle(const string &key, std::shared_ptr<const QuadTreeRectangleP> qtr);
+
+    // As above for bounding volume hierarchies. Keys must differ from
+    // those of quad trees
+    //
+    std::shared_ptr<const BVHRectangle> _getBVHRectangle(const string &key);
+
+    void _putBVHRectangle(const string &key, std::shared_ptr<const BVHRectangle> bvh);
+
+    template<class T> std::shared_ptr<const T> _getLocator(lru_cache<string, std::shared_ptr<const T>> &cache, std::map<string, std::weak_ptr<const T>> &live, const string &key);
+
+    template<class T> void _putLocator(lru_cache<string, std::shared_ptr<const T>> &cache, std::map<string, std::weak_ptr<const T>> &live, const string &key, std::shared_ptr<const T> locator);
+
     string _getQuadTreeRectangleKey(size_t ts, int level, int lod, const vector<DC::CoordVar> &cvarsinfo, const DimsType &bmin, const DimsType &bmax) const;
 };
 
@@ -0,0 +1,205 @@
+#ifndef _GridTraversal_
+#define _GridTraversal_
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+#include <vapor/Grid.h>
+#include <vapor/StructuredGrid.h>
+
+namespace VAPoR {
+
+//! \file GridTraversal.h
+//! \brief Block-wise traversal kernels for grid node values
+//!
+//! The functions in this file visit the values of a grid by walking its
+//! blocked storage directly, one block row at a time, instead of going
+//! through Grid::ConstIterator. Apart from a few calls made once per
+//! traversal there are no virtual calls, and the innermost loop is a unit
+//! stride loop over a contiguous run of floats that the compiler can
+//! inline the functor into and vectorize.
+//!
+//! The functions are templated on the concrete grid class \p GridT and on
+//! the functor, so each combination is compiled into its own kernel.
+//! ForEachNode() and Reduce() accept any Grid, ForEachCell() requires a
+//! StructuredGrid (RegularGrid, StretchedGrid, LayeredGrid,
+//! CurvilinearGrid). Nodes are visited in block order, not in index order.
+//!
+
+namespace GridTraversalImpl {
+
+// Storage layout of a grid's node values
+//
+struct layout_t {
+    layout_t(const Grid &g) : dims(g.GetDimensions()), blks(g.GetBlks())
+    {
+        Grid::CopyToArr3(g.GetBlockSize(), bs);
+        Grid::CopyToArr3(g.GetDimensionInBlks(), bdims);
+    }
+
+    const float *block(size_t ib, size_t jb, size_t kb) const { return (blks[kb * bdims[0] * bdims[1] + jb * bdims[0] + ib]); }
+
+    DimsType                    dims;
+    DimsType                    bs = {1, 1, 1};
+    DimsType                    bdims = {1, 1, 1};
+    const std::vector<float *> &blks;
+};
+
+// Invoke row(values, n, index) for every run of nodes that lie in the
+// same row of the same block, for blocks in the Z block range [kb0, kb1).
+// 'values' points to the n contiguous node values of the run, and 'index'
+// holds the grid index of the first of them
+//
+template<class F> void ForEachRow(const layout_t &l, size_t kb0, size_t kb1, F row)
+{
+    for (size_t kb = kb0; kb < kb1; kb++) {
+        for (size_t jb = 0; jb < l.bdims[1]; jb++) {
+            for (size_t ib = 0; ib < l.bdims[0]; ib++) {
+                const float *blk = l.block(ib, jb, kb);
+
+                size_t nx = std::min(l.bs[0], l.dims[0] - ib * l.bs[0]);
+                size_t ny = std::min(l.bs[1], l.dims[1] - jb * l.bs[1]);
+                size_t nz = std::min(l.bs[2], l.dims[2] - kb * l.bs[2]);
+
+                for (size_t z = 0; z < nz; z++) {
+                    for (size_t y = 0; y < ny; y++) {
+                        DimsType index = {ib * l.bs[0], jb * l.bs[1] + y, kb * l.bs[2] + z};
+                        row(blk + (z * l.bs[1] + y) * l.bs[0], nx, index);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Copy the row of node values at (j,k) into the contiguous array dst
+//
+inline void GatherRow(const layout_t &l, size_t j, size_t k, float *dst)
+{
+    size_t offset = ((k % l.bs[2]) * l.bs[1] + (j % l.bs[1])) * l.bs[0];
+    for (size_t ib = 0; ib < l.bdims[0]; ib++) {
+        const float *src = l.block(ib, j / l.bs[1], k / l.bs[2]) + offset;
+        size_t       n = std::min(l.bs[0], l.dims[0] - ib * l.bs[0]);
+        std::copy(src, src + n, dst + ib * l.bs[0]);
+    }
+}
+
+};    // namespace GridTraversalImpl
+
+//! Apply a functor to every node of a grid
+//!
+//! \param[in] g The grid
+//! \param[in] f A functor invoked as \p f(const DimsType &index, float value)
+//! for every node of \p g, including nodes with missing values
+//!
+template<class GridT, class F> void ForEachNode(const GridT &g, F f)
+{
+    static_assert(std::is_base_of<Grid, GridT>::value, "GridT must be a Grid");
+
+    GridTraversalImpl::layout_t l(g);
+    if (l.blks.empty()) return;
+
+    GridTraversalImpl::ForEachRow(l, 0, l.bdims[2], [&f](const float *row, size_t n, DimsType index) {
+        size_t i0 = index[0];
+        for (size_t i = 0; i < n; i++) {
+            index[0] = i0 + i;
+            f((const DimsType &)index, row[i]);
+        }
+    });
+}
+
+//! Apply a functor to every cell of a structured grid
+//!
+//! \param[in] g The grid
+//! \param[in] f A functor invoked as \p f(const DimsType &cell, const float *values)
+//! for every cell of \p g. \p values holds the values of the cell's
+//! 4 (2D) or 8 (3D) corner nodes, ordered with the I index varying
+//! fastest, then J, then K. Cells with missing values are not skipped.
+//!
+template<class GridT, class F> void ForEachCell(const GridT &g, F f)
+{
+    static_assert(std::is_base_of<StructuredGrid, GridT>::value, "GridT must be a StructuredGrid");
+
+    GridTraversalImpl::layout_t l(g);
+    const DimsType             &dims = l.dims;
+    size_t                      topo = g.GetTopologyDim();
+    if (l.blks.empty()) return;
+    for (size_t d = 0; d < topo; d++) {
+        if (dims[d] < 2) return;
+    }
+
+    // Cells straddle block boundaries, so gather two (or four) node rows
+    // into contiguous scratch rows once, and then read the corners of
+    // each cell with unit stride
+    //
+    size_t             nx = dims[0];
+    size_t             nrows = topo == 3 ? 4 : 2;
+    std::vector<float> rows(nrows * nx);
+
+    size_t nk = topo == 3 ? dims[2] - 1 : 1;
+    float  values[8];
+    for (size_t k = 0; k < nk; k++) {
+        for (size_t j = 0; j < dims[1] - 1; j++) {
+            for (size_t r = 0; r < nrows; r++) GridTraversalImpl::GatherRow(l, j + (r & 1), k + (r >> 1), rows.data() + r * nx);
+
+            DimsType cell = {0, j, k};
+            for (size_t i = 0; i < nx - 1; i++) {
+                for (size_t r = 0; r < nrows; r++) {
+                    values[2 * r] = rows[r * nx + i];
+                    values[2 * r + 1] = rows[r * nx + i + 1];
+                }
+                cell[0] = i;
+                f((const DimsType &)cell, (const float *)values);
+            }
+        }
+    }
+}
+
+//! Reduce the node values of a grid in parallel
+//!
+//! Nodes whose value equals the grid's missing value are skipped. The
+//! grid is partitioned into slabs of blocks, each slab is reduced by a
+//! single thread starting from \p init, and the per-slab results are then
+//! combined in order.
+//!
+//! \param[in] g The grid
+//! \param[in] init The initial (identity) value of the reduction
+//! \param[in] op A functor invoked as \p op(T acc, float value) that
+//! returns the accumulation of \p value into \p acc
+//! \param[in] combine A functor invoked as \p combine(T a, T b) that
+//! returns the combination of two partial results
+//!
+//! \retval result The result of the reduction, or \p init if the grid
+//! has no valid nodes
+//!
+template<class T, class GridT, class Op, class Combine> T Reduce(const GridT &g, T init, Op op, Combine combine)
+{
+    static_assert(std::is_base_of<Grid, GridT>::value, "GridT must be a Grid");
+
+    GridTraversalImpl::layout_t l(g);
+    if (l.blks.empty()) return (init);
+
+    long           nslabs = (long)l.bdims[2];
+    std::vector<T> partial(nslabs, init);
+
+    float mv = g.GetMissingValue();
+
+#pragma omp parallel for schedule(dynamic)
+    for (long kb = 0; kb < nslabs; kb++) {
+        T acc = init;
+        GridTraversalImpl::ForEachRow(l, kb, kb + 1, [&](const float *row, size_t n, const DimsType &) {
+            for (size_t i = 0; i < n; i++) {
+                if (row[i] != mv) acc = op(acc, row[i]);
+            }
+        });
+        partial[kb] = acc;
+    }
+
+    T result = init;
+    for (long kb = 0; kb < nslabs; kb++) result = combine(result, partial[kb]);
+    return (result);
+}
+
+};    // namespace VAPoR
+
+#endif
@@ -61,6 +61,14 @@ public:
     //!
     float GetValue(const CoordType &coords) const override;
 
+    //! \copydoc Grid::GetValues()
+    //!
+    //! With linear interpolation the Z coordinates of the cell columns
+    //! searched for one point are reused for following points that fall in
+    //! the same column. Other interpolation orders use GetValue().
+    //
+    virtual void GetValues(const double *xyz, size_t n, float *values) const override;
+
     //! \copydoc Grid::GetInterpolationOrder()
     //
     virtual int GetInterpolationOrder() const override { return _interpolationOrder; };
@@ -261,7 +269,18 @@ private:
 
     double _interpolateVaryingCoord(size_t i0, size_t j0, size_t k0, double x, double y) const;
 
-    bool _insideGrid(const CoordType &coords, DimsType &indices, double wgts[3]) const;
+    // Z coordinates of the four node columns at the corners of the last
+    // horizontal cell searched by _insideGrid(), reused by GetValues()
+    // while consecutive points fall in the same cell
+    //
+    struct zColumns_t {
+        size_t              i = 0;
+        size_t              j = 0;
+        std::vector<float>  z[4];    // Corners ordered (i,j), (i+1,j), (i,j+1), (i+1,j+1)
+        std::vector<double> zcoords;
+    };
+
+    bool _insideGrid(const CoordType &coords, DimsType &indices, double wgts[3], zColumns_t *columns = nullptr) const;
 };
 };    // namespace VAPoR
 #endif
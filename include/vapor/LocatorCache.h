@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+#include <vapor/MyBase.h>
+#include <vapor/QuadTreeRectangleP.h>
+#include <vapor/BVHRectangle.h>
+
+namespace VAPoR {
+
+//
+//! \class LocatorCache
+//! \brief A persistent, file based cache of cell locators
+//!
+//! Building the cell locator (QuadTreeRectangleP or BVHRectangle) of a
+//! large curvilinear or unstructured mesh can take seconds, and is
+//! repeated whenever a grid is constructed on a mesh whose locator is
+//! not in memory, e.g. in every new session. This class
+//! stores locators in files in a directory, keyed by a fingerprint of
+//! the mesh coordinates, so that they can be loaded instead of
+//! rebuilt.
+//!
+//! A quad tree or BVH is stored as a flat binary image (see
+//! QuadTreeRectangleP::Serialize()) which is memory mapped and copied
+//! into place when loaded. Files are written under a temporary name and
+//! then renamed, so concurrent sessions sharing a directory never see a
+//! partially written locator.
+//!
+//! Unlike SpillCache, files persist after the instance is destroyed, and
+//! the size of the directory is not limited. Files are only readable on
+//! hosts with the same byte order as the host that wrote them.
+//!
+//! All methods may be called concurrently from multiple threads.
+//
+class VDF_API LocatorCache : public Wasp::MyBase {
+public:
+    LocatorCache();
+    virtual ~LocatorCache() {}
+
+    //! Enable the cache
+    //!
+    //! \param[in] dir Directory in which locators are stored. The
+    //! directory must exist. If empty the cache is disabled.
+    //
+    int Initialize(std::string dir);
+
+    //! Return true if the cache has been initialized with a directory
+    //
+    bool Enabled() const;
+
+    //! Compute a key identifying a mesh
+    //!
+    //! Returns a 128 bit hash, as a string of hexadecimal digits, of the
+    //! contents of a list of memory buffers. The buffers should hold the
+    //! mesh coordinates and anything else that determines the locator's
+    //! contents, such as dimensions, connectivity, and the subset of the
+    //! mesh covered.
+    //!
+    //! \param[in] buffers Pairs of buffer address and size in bytes
+    //
+    static std::string Fingerprint(const std::vector<std::pair<const void *, size_t>> &buffers);
+
+    //! Load a quad tree
+    //!
+    //! \retval qtr The quad tree stored under \p key, or NULL if there is
+    //! none or the cache is disabled
+    //
+    std::shared_ptr<QuadTreeRectangleP> GetQuadTreeRectangle(const std::string &key) const;
+
+    //! Store a quad tree under \p key
+    //!
+    //! \retval bool True if the tree was stored
+    //
+    bool PutQuadTreeRectangle(const std::string &key, const QuadTreeRectangleP &qtr) const;
+
+    //! Load a bounding volume hierarchy
+    //!
+    //! \retval bvh The hierarchy stored under \p key, or NULL if there is
+    //! none or the cache is disabled
+    //
+    std::shared_ptr<BVHRectangle> GetBVHRectangle(const std::string &key) const;
+
+    //! Store a bounding volume hierarchy under \p key
+    //!
+    //! \retval bool True if the hierarchy was stored
+    //
+    bool PutBVHRectangle(const std::string &key, const BVHRectangle &bvh) const;
+
+private:
+    std::string        _dir;
+    mutable std::mutex _mutex;
+
+    std::string _path(const std::string &key, const std::string &ext) const;
+
+    // Write a file holding a header and the data produced by writer
+    //
+    template<class F> bool _write(const std::string &path, uint32_t kind, uint64_t size, F writer) const;
+};
+};    // namespace VAPoR
@@ -62,7 +62,7 @@ const float BELOW_GRID = 0.f;
 //
 // The MyBase base class provides a simple error reporting mechanism
 // that can be used by derrived classes. N.B. the error messages/codes
-// are stored in static class members.
+// are global, but each thread has its own copy.
 //
 class COMMON_API MyBase {
 public:
@@ -103,7 +103,7 @@ public:
     //! \sa SetErrMsg(), SetErrCode()
     //! \retval msg A pointer to null-terminated string.
     //
-    static const char *GetErrMsg() { return (ErrMsg); }
+    static const char *GetErrMsg();
 
     //! Record an error code
     //
@@ -111,7 +111,7 @@ public:
     //! \param[in] err_code The error code
     //! \sa GetErrMsg(), GetErrCode(), SetErrMsg()
     //
-    static void SetErrCode(int err_code) { ErrCode = err_code; }
+    static void SetErrCode(int err_code);
 
     //! Retrieve the current error code
     //
@@ -120,7 +120,7 @@ public:
     //! \sa SetErrMsg(), SetErrCode()
     //! \retval code An erroor code
     //
-    static int GetErrCode() { return (ErrCode); }
+    static int GetErrCode();
 
     //! Set a callback function for error messages
     //!
@@ -183,7 +183,7 @@ public:
     //! \sa SetDiagMsg()
     //! \retval msg A pointer to null-terminated string.
     //
-    static const char *GetDiagMsg() { return (DiagMsg); }
+    static const char *GetDiagMsg();
 
     //! Set a callback function for diagnostic messages
     //!
@@ -233,29 +233,22 @@ public:
     //! either through the error message callback or the error message
     //! FILE pointer.
     //!
+    //! The setting applies only to the calling thread.
+    //!
     //! \param[in] enable Boolean flag to enable or disable error reporting
     //!
-    static bool EnableErrMsg(bool enable)
-    {
-        bool prev = Enabled;
-        Enabled = enable;
-        return (prev);
-    };
-
-    static bool GetEnableErrMsg() { return Enabled; }
-
-    // N.B. the error codes/messages are stored in static class members!!!
-    static char *     ErrMsg;
-    static int        ErrCode;
-    static int        ErrMsgSize;
+    static bool EnableErrMsg(bool enable);
+
+    static bool GetEnableErrMsg();
+
+    // N.B. the error codes/messages themselves are thread local and
+    // are not class members. See MyBase.cpp
+    //
     static FILE *     ErrMsgFilePtr;
     static ErrMsgCB_T ErrMsgCB;
 
-    static char *      DiagMsg;
-    static int         DiagMsgSize;
     static FILE *      DiagMsgFilePtr;
     static DiagMsgCB_T DiagMsgCB;
-    static bool        Enabled;
 
 protected:
     void SetClassName(const string &name) { _className = name; };
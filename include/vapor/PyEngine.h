@@ -195,6 +195,11 @@ private:
 
         bool GetDataVarInfo(DC::DataVar &cvar) const;
 
+        // Scripts run in the interpreter, which requires the thread
+        // holding the GIL
+        //
+        bool IsThreadSafe() const { return (false); }
+
         //! Return stdout from most recent execution of script
         //!
         string GetScriptStdout() const { return (_stdoutString); }
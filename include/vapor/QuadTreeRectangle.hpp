@@ -6,6 +6,8 @@
 #include <cmath>
 #include <iostream>
 #include <cstdint>
+#include <cstring>
+#include <type_traits>
 #include <vapor/VAssert.h>
 
 namespace VAPoR {
@@ -223,6 +225,29 @@ public:
         node_t::get_payload_contains(_nodes, _rootidx, x, y, payloads);
     }
 
+    //! Return a list of payloads that may intersect a specified rectangle
+    //!
+    //! This method searches the tree for all nodes whose associated regions
+    //! intersect the rectangle defined by \p left, \p top, \p right, and
+    //! \p bottom, and returns any payload found at those nodes. The
+    //! result is conservative: every payload whose region intersects the
+    //! rectangle is returned, but so may be payloads whose regions
+    //! only intersect the same tree nodes. A payload may be returned more
+    //! than once.
+    //!
+    //! \p param[in] left X coordinate of left edge of rectangle
+    //! \p param[in] top Y coordinate of top edge of rectangle
+    //! \p param[in] right X coordinate of right edge of rectangle
+    //! \p param[in] bottom Y coordinate of bottom edge of rectangle
+    //! \p payloads[out] A vector of payloads
+    //!
+    void GetPayloadIntersected(T left, T top, T right, T bottom, std::vector<S> &payloads) const
+    {
+        payloads.clear();
+
+        node_t::get_payload_intersects(_nodes, _rootidx, rectangle_t(left, top, right, bottom), payloads);
+    }
+
     //! Return informational statistics about the current tree
     //!
     //! This method returns stats about the tree
@@ -251,6 +276,125 @@ public:
         }
     }
 
+    //! Append a flat binary image of the tree to a buffer
+    //!
+    //! The image contains the bounds of the tree, one record per node
+    //! giving the location of the node's children and its number of
+    //! payloads, and the payloads of all of the nodes. Node bounds
+    //! and levels are not stored, they are recomputed from the root
+    //! bounds. The image may be written to a file and later passed to
+    //! Deserialize() to recreate the tree without performing any
+    //! insertions. \p T and \p S must be trivially copyable, and the
+    //! image is only readable on a host with the same byte order.
+    //!
+    //! \param[out] buf Buffer to which the image is appended
+    //!
+    //! \sa Deserialize()
+    //
+    void Serialize(std::vector<unsigned char> &buf) const
+    {
+        static_assert(std::is_trivially_copyable<T>::value && std::is_trivially_copyable<S>::value, "QuadTreeRectangle::Serialize() requires trivially copyable types");
+        VAssert(_nodes.size() <= std::numeric_limits<uint32_t>::max());
+
+        uint64_t npayloads = 0;
+        for (size_t i = 0; i < _nodes.size(); i++) npayloads += _nodes[i].get_payloads().size();
+
+        uint64_t           header[] = {(uint64_t)_maxDepth, (uint64_t)_rootidx, (uint64_t)_nodes.size(), npayloads};
+        const rectangle_t &root = _nodes[_rootidx].bounds();
+        T                  bounds[] = {root._left, root._top, root._right, root._bottom};
+
+        size_t offset = buf.size();
+        buf.resize(offset + sizeof(header) + sizeof(bounds) + _nodes.size() * sizeof(typename node_t::record_t) + npayloads * sizeof(S));
+        unsigned char *ptr = buf.data() + offset;
+
+        std::memcpy(ptr, header, sizeof(header));
+        ptr += sizeof(header);
+        std::memcpy(ptr, bounds, sizeof(bounds));
+        ptr += sizeof(bounds);
+
+        for (size_t i = 0; i < _nodes.size(); i++) {
+            typename node_t::record_t r = _nodes[i].get_record();
+            std::memcpy(ptr, &r, sizeof(r));
+            ptr += sizeof(r);
+        }
+        for (size_t i = 0; i < _nodes.size(); i++) {
+            const std::vector<S> &payloads = _nodes[i].get_payloads();
+            if (payloads.empty()) continue;
+
+            std::memcpy(ptr, payloads.data(), payloads.size() * sizeof(S));
+            ptr += payloads.size() * sizeof(S);
+        }
+    }
+
+    //! Replace the contents of the tree with an image created by Serialize()
+    //!
+    //! \param[in,out] ptr Start of the image. On success \p ptr is
+    //! advanced to the first byte following the image.
+    //! \param[in] end End of the buffer containing the image
+    //!
+    //! \retval status Returns false, and leaves the tree unchanged, if the
+    //! image is truncated or inconsistent
+    //!
+    //! \sa Serialize()
+    //
+    bool Deserialize(const unsigned char *&ptr, const unsigned char *end)
+    {
+        typedef typename node_t::record_t record_t;
+
+        uint64_t header[4];
+        T        bounds[4];
+        size_t   nbytes = end - ptr;
+        if (nbytes < sizeof(header) + sizeof(bounds)) return (false);
+        std::memcpy(header, ptr, sizeof(header));
+        std::memcpy(bounds, ptr + sizeof(header), sizeof(bounds));
+
+        uint64_t rootidx = header[1];
+        uint64_t nnodes = header[2];
+        uint64_t npayloads = header[3];
+        if (nnodes == 0 || rootidx >= nnodes) return (false);
+        if (nnodes > nbytes / sizeof(record_t) || npayloads > nbytes / sizeof(S)) return (false);
+        if (nbytes < sizeof(header) + sizeof(bounds) + nnodes * sizeof(record_t) + npayloads * sizeof(S)) return (false);
+
+        const unsigned char *records = ptr + sizeof(header) + sizeof(bounds);
+        const unsigned char *payloads = records + nnodes * sizeof(record_t);
+
+        // Children are always stored after their parent, so visiting the
+        // nodes in order gives every node its bounds and level before
+        // it is reached. Each node other than the root must be the child
+        // of exactly one node.
+        //
+        std::vector<node_t> nodes(nnodes);
+        std::vector<bool>   placed(nnodes, false);
+        nodes[rootidx] = node_t(bounds[0], bounds[1], bounds[2], bounds[3], 0);
+        placed[rootidx] = true;
+
+        uint64_t poffset = 0;
+        for (size_t i = 0; i < nnodes; i++) {
+            if (!placed[i]) return (false);
+
+            record_t r;
+            std::memcpy(&r, records + i * sizeof(record_t), sizeof(r));
+            if (r.npayloads > npayloads - poffset) return (false);
+
+            nodes[i].set_record(r, payloads + poffset * sizeof(S));
+            poffset += r.npayloads;
+
+            if (!r.child0) continue;
+            if (r.child0 <= i || (uint64_t)r.child0 + 4 > nnodes) return (false);
+            for (uint32_t q = 0; q < 4; q++) {
+                if (placed[r.child0 + q]) return (false);
+                nodes[r.child0 + q] = node_t(nodes[i].bounds().quadrant(q), nodes[i].get_level() + 1);
+                placed[r.child0 + q] = true;
+            }
+        }
+
+        _nodes = std::move(nodes);
+        _rootidx = rootidx;
+        _maxDepth = header[0];
+        ptr = payloads + npayloads * sizeof(S);
+        return (true);
+    }
+
     friend std::ostream &operator<<(std::ostream &os, const QuadTreeRectangle &q)
     {
         os << "Num nodes : " << q._nodes.size() << std::endl;
@@ -367,6 +511,21 @@ private:
             }
         }
 
+        static void get_payload_intersects(const std::vector<node_t> &nodes, size_t nidx, const rectangle_t &rec, std::vector<S> &payloads)
+        {
+            const node_t &node = nodes[nidx];
+
+            if (!node._rectangle.intersects(rec)) return;
+
+            if (node._payloads.size()) { payloads.insert(payloads.end(), node._payloads.begin(), node._payloads.end()); }
+            if (node._is_leaf) return;
+
+            for (int q = 0; q < 4; q++) {
+                size_t child = node_t::quadrant(nodes, nidx, q);
+                node_t::get_payload_intersects(nodes, child, rec, payloads);
+            }
+        }
+
         static void print(const std::vector<node_t> &nodes, size_t nidx, std::ostream &os)
         {
             const node_t &node = nodes[nidx];
@@ -387,6 +546,31 @@ private:
         const std::vector<S> &get_payloads() const { return (_payloads); }
         size_t                get_level() const { return (_level); }
 
+        // Fixed size representation of a node used by Serialize(). The
+        // node's bounds and level are implied by its parent, and its
+        // payloads are stored separately. child0 is zero for a leaf
+        //
+        struct record_t {
+            uint32_t child0;
+            uint32_t npayloads;
+        };
+
+        record_t get_record() const
+        {
+            record_t r;
+            r.child0 = _is_leaf ? 0 : (uint32_t)_child0;
+            r.npayloads = (uint32_t)_payloads.size();
+            return (r);
+        }
+
+        void set_record(const record_t &r, const unsigned char *payloads)
+        {
+            _is_leaf = r.child0 == 0;
+            _child0 = r.child0;
+            _payloads.resize(r.npayloads);
+            if (r.npayloads) std::memcpy(_payloads.data(), payloads, r.npayloads * sizeof(S));
+        }
+
     private:
         int            _level;
         bool           _is_leaf;
@@ -69,10 +69,34 @@ public:
     //
     void GetPayloadContained(float x, float y, std::vector<DimsType> &payloads) const;
 
+    //! \copydoc QuadTreeRectangle::GetPayloadIntersected()
+    //
+    void GetPayloadIntersected(float left, float top, float right, float bottom, std::vector<DimsType> &payloads) const;
+
     //! \copydoc QuadTreeRectangle::GetStats()
     //
     void GetStats(std::vector<size_t> &payload_histo, std::vector<size_t> &level_histo) const;
 
+    //! Append a flat binary image of the tree to a buffer
+    //!
+    //! \sa QuadTreeRectangle::Serialize(), LocatorCache
+    //
+    void Serialize(std::vector<unsigned char> &buf) const;
+
+    //! Replace the contents of the tree with an image created by Serialize()
+    //!
+    //! The tree is recreated from the image by copying, without
+    //! performing any insertions. The number of subtrees is that of the
+    //! serialized tree, not the number of threads currently available.
+    //!
+    //! \param[in] buf Image
+    //! \param[in] nbytes Size of \p buf in bytes
+    //!
+    //! \retval status Returns false, and leaves the tree unchanged, if the
+    //! image is truncated or inconsistent
+    //
+    bool Deserialize(const unsigned char *buf, size_t nbytes);
+
     friend std::ostream &operator<<(std::ostream &os, const QuadTreeRectangleP &q)
     {
         for (int i = 0; i < q._qtrs.size(); i++) {
@@ -74,6 +74,14 @@ public:
     //
     virtual bool InsideGrid(const CoordType &coords) const override;
 
+    //! \copydoc Grid::GetValues()
+    //!
+    //! Points are processed in packets. Cell indices and interpolation
+    //! weights for all points of a packet are computed in vectorizable
+    //! loops, and corner values are then read directly from block storage.
+    //
+    virtual void GetValues(const double *xyz, size_t n, float *values) const override;
+
     class ConstCoordItrRG : public Grid::ConstCoordItrAbstract {
     public:
         ConstCoordItrRG(const RegularGrid *rg, bool begin);
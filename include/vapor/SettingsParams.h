@@ -54,6 +54,20 @@ public:
     long GetCacheMB() const;
     void SetCacheMB(long val);
 
+    // Locate the cells of unstructured grids with a bounding volume
+    // hierarchy rather than a quad tree. See DataMgr::SetCellLocator()
+    //
+    bool GetUseBVHCellLocator() const;
+    void SetUseBVHCellLocator(bool val);
+
+    // Keep the cell locators of curvilinear and unstructured grids in
+    // files in a directory. See DataMgr::SetLocatorCache()
+    //
+    bool   GetLocatorCacheEnabled() const;
+    void   SetLocatorCacheEnabled(bool val);
+    string GetLocatorCacheDir() const;
+    void   SetLocatorCacheDir(string dir);
+
     long GetTextureSize() const;
     void SetTextureSize(long val);
     void SetTexSizeEnable(bool val);
@@ -123,6 +137,7 @@ public:
     int SaveSettings() const;
 
     static const string _sessionAutoSaveEnabledTag;
+    static const string LocatorCacheEnabledTag;
 
     std::string GetSettingsPath() const;
 
@@ -146,6 +161,8 @@ private:
     static const string _shortName;
     static const string _numThreadsTag;
     static const string _cacheMBTag;
+    static const string _useBVHCellLocatorTag;
+    static const string _locatorCacheDirTag;
     static const string _texSizeTag;
     static const string _texSizeEnableTag;
     static const string _currentPrefsPathTag;
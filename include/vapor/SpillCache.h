@@ -0,0 +1,106 @@
+#pragma once
+
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <mutex>
+#include <vapor/MyBase.h>
+
+namespace VAPoR {
+
+//
+//! \class SpillCache
+//! \brief A size limited, file backed cache of memory blocks
+//!
+//! Stores copies of memory blocks, identified by a string key, in raw
+//! files in a directory on local storage, such as an SSD. When the
+//! total size of the stored blocks would exceed a user defined limit
+//! the least recently used blocks are discarded. Stored blocks are
+//! retrieved by memory mapping their files.
+//!
+//! Files are created with a name unique to the SpillCache instance,
+//! and are removed when the instance is cleared or destroyed.
+//!
+//! All methods may be called concurrently from multiple threads.
+//
+class VDF_API SpillCache : public Wasp::MyBase {
+public:
+    SpillCache();
+    virtual ~SpillCache();
+
+    //! Enable the cache
+    //!
+    //! Any blocks already stored are discarded.
+    //!
+    //! \param[in] dir Directory in which files are created. The directory
+    //! must exist. If empty the cache is disabled.
+    //! \param[in] maxBytes Maximum total size of stored blocks, in bytes
+    //
+    int Initialize(std::string dir, size_t maxBytes);
+
+    //! Return true if the cache has been initialized with a directory
+    //
+    bool Enabled() const;
+
+    //! Store a copy of a memory block
+    //!
+    //! If a block is already stored under \p key it is assumed to be
+    //! identical and is not rewritten.
+    //!
+    //! \param[in] key Key uniquely identifying the block
+    //! \param[in] tag Group to which the block belongs. See Purge()
+    //! \param[in] data Block to copy
+    //! \param[in] nbytes Size of \p data in bytes
+    //!
+    //! \retval bool True if the block was stored
+    //
+    bool Put(const std::string &key, const std::string &tag, const void *data, size_t nbytes);
+
+    //! Retrieve a copy of a memory block
+    //!
+    //! \param[in] key Key identifying the block
+    //! \param[out] data Destination for the block
+    //! \param[in] nbytes Size of \p data in bytes. Must match the size
+    //! of the stored block
+    //!
+    //! \retval bool True if the block was found and copied to \p data
+    //
+    bool Get(const std::string &key, void *data, size_t nbytes);
+
+    //! Discard all stored blocks belonging to the group \p tag
+    //
+    void Purge(const std::string &tag);
+
+    //! Discard all stored blocks
+    //
+    void Clear();
+
+    //! Return the total size, in bytes, of the stored blocks
+    //
+    size_t GetSize() const;
+
+private:
+    struct entry_t {
+        std::string key;
+        std::string tag;
+        std::string path;
+        size_t      nbytes;
+    };
+
+    // Stored blocks ordered from least (front) to most (back) recently
+    // used
+    //
+    std::list<entry_t>                                            _lru;
+    std::unordered_map<std::string, std::list<entry_t>::iterator> _index;
+
+    std::string _dir;
+    std::string _prefix;    // file name prefix unique to this instance
+    size_t      _maxBytes;
+    size_t      _size;
+    size_t      _nextFile;
+
+    mutable std::mutex _mutex;
+
+    void _erase(std::list<entry_t>::iterator itr);
+};
+};    // namespace VAPoR
@@ -93,6 +93,13 @@ public:
     //
     virtual bool InsideGrid(const CoordType &coords) const override;
 
+    //! \copydoc Grid::GetValues()
+    //!
+    //! The cell containing each point is used as the starting guess when
+    //! locating the next one.
+    //
+    virtual void GetValues(const double *xyz, size_t n, float *values) const override;
+
     //! Returns reference to vector containing X user coordinates
     //!
     //! Returns reference to vector passed to constructor
@@ -161,7 +168,10 @@ private:
 
     void _stretchedGrid(const std::vector<double> &xcoords, const std::vector<double> &ycoords, const std::vector<double> &zcoords);
 
-    bool _insideGrid(double x, double y, double z, size_t &i, size_t &j, size_t &k, double &xwgt, double &ywgt, double &zwgt) const;
+    // If hint is true the incoming values of i, j, and k are tried as the
+    // cell indices before searching the coordinate arrays
+    //
+    bool _insideGrid(double x, double y, double z, size_t &i, size_t &j, size_t &k, double &xwgt, double &ywgt, double &zwgt, bool hint = false) const;
 };
 };    // namespace VAPoR
 #endif
@@ -44,6 +44,12 @@ class VDF_API UnstructuredGrid : public Grid {
 public:
     enum Location { NODE, CELL, EDGE };
 
+    //! Spatial index used to find the cell containing a point
+    //!
+    //! \sa QuadTreeRectangleP, BVHRectangle
+    //
+    enum CellLocator { QUADTREE, BVH };
+
     //!
     //! Construct a unstructured grid sampling a 3D or 2D scalar function
     //!
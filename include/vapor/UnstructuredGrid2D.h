@@ -8,6 +8,7 @@
 #include <vapor/UnstructuredGrid.h>
 #include <vapor/UnstructuredGridCoordless.h>
 #include <vapor/QuadTreeRectangleP.h>
+#include <vapor/BVHRectangle.h>
 
 #ifdef WIN32
     #pragma warning(disable : 4661 4251)    // needed for template class
@@ -24,18 +25,24 @@ class VDF_API UnstructuredGrid2D : public UnstructuredGrid {
 public:
     //! Construct a unstructured grid sampling 2D scalar function
     //!
+    //! Cells are located with a quad tree, \p qtr, or a bounding volume
+    //! hierarchy, \p bvh, as selected by \p locator. If the selected one
+    //! is NULL it is built from the grid's cells. Either may be shared with
+    //! other grids on the same coordinates.
     //
     UnstructuredGrid2D(const DimsType &vertexDims, const DimsType &faceDims, const DimsType &edgeDims, const DimsType &bs, const std::vector<float *> &blks, const int *vertexOnFace,
                        const int *faceOnVertex, const int *faceOnFace,
                        Location location,    // node,face, edge
                        size_t maxVertexPerFace, size_t maxFacePerVertex, long nodeOffset, long cellOffset, const UnstructuredGridCoordless &xug, const UnstructuredGridCoordless &yug,
-                       const UnstructuredGridCoordless &zug, std::shared_ptr<const QuadTreeRectangleP> qtr);
+                       const UnstructuredGridCoordless &zug, std::shared_ptr<const QuadTreeRectangleP> qtr, std::shared_ptr<const BVHRectangle> bvh = nullptr,
+                       CellLocator locator = QUADTREE);
 
     UnstructuredGrid2D(const std::vector<size_t> &vertexDims, const std::vector<size_t> &faceDims, const std::vector<size_t> &edgeDims, const std::vector<size_t> &bs, const std::vector<float *> &blks,
                        const int *vertexOnFace, const int *faceOnVertex, const int *faceOnFace,
                        Location location,    // node,face, edge
                        size_t maxVertexPerFace, size_t maxFacePerVertex, long nodeOffset, long cellOffset, const UnstructuredGridCoordless &xug, const UnstructuredGridCoordless &yug,
-                       const UnstructuredGridCoordless &zug, std::shared_ptr<const QuadTreeRectangleP> qtr);
+                       const UnstructuredGridCoordless &zug, std::shared_ptr<const QuadTreeRectangleP> qtr, std::shared_ptr<const BVHRectangle> bvh = nullptr,
+                       CellLocator locator = QUADTREE);
 
     UnstructuredGrid2D() = default;
     virtual ~UnstructuredGrid2D()
@@ -43,8 +50,32 @@ public:
         if (_qtr) _qtr = nullptr;
     }
 
+    //! Return the quad tree, or NULL if the grid was constructed with the
+    //! BVH locator
+    //
     std::shared_ptr<const QuadTreeRectangleP> GetQuadTreeRectangle() const { return (_qtr); }
 
+    //! Use a bounding volume hierarchy to locate cells
+    //!
+    //! If a BVH is set, by the constructor or this method, cells
+    //! containing a point are found with it rather than the quad tree.
+    //! \p bvh must have been built from this grid's
+    //! cells, e.g. by MakeBVHRectangle(), and may be shared with other
+    //! grids on the same coordinates. Passing null restores the quad tree,
+    //! which is only valid if the grid has one.
+    //!
+    //! \sa BVHRectangle, MakeBVHRectangle()
+    //
+    void SetBVHRectangle(std::shared_ptr<const BVHRectangle> bvh) { _bvh = bvh; }
+
+    std::shared_ptr<const BVHRectangle> GetBVHRectangle() const { return (_bvh); }
+
+    //! Build a bounding volume hierarchy over this grid's cells
+    //!
+    //! \sa SetBVHRectangle()
+    //
+    std::shared_ptr<BVHRectangle> MakeBVHRectangle() const;
+
     virtual DimsType GetCoordDimensions(size_t dim) const override;
 
     virtual size_t GetGeometryDim() const override;
@@ -132,6 +163,7 @@ private:
     UnstructuredGridCoordless                 _yug;
     UnstructuredGridCoordless                 _zug;
     std::shared_ptr<const QuadTreeRectangleP> _qtr;
+    std::shared_ptr<const BVHRectangle>       _bvh;
 
     bool _insideGrid(const CoordType &coords, size_t &face, std::vector<size_t> &nodes, double *lambda, int &nlambda) const;
 
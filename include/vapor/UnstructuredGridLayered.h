@@ -23,24 +23,44 @@ class VDF_API UnstructuredGridLayered : public UnstructuredGrid {
 public:
     //! Construct a unstructured grid sampling Layered scalar function
     //!
+    //! \p qtr, \p bvh and \p locator select the cell locator of the
+    //! horizontal 2D mesh, as for UnstructuredGrid2D
     //
     UnstructuredGridLayered(const DimsType &vertexDims, const DimsType &faceDims, const DimsType &edgeDims, const DimsType &bs, const std::vector<float *> &blks, const int *vertexOnFace,
                             const int *faceOnVertex, const int *faceOnFace,
                             Location location,    // node,face, edge
                             size_t maxVertexPerFace, size_t maxFacePerVertex, long nodeOffset, long cellOffset, const UnstructuredGridCoordless &xug, const UnstructuredGridCoordless &yug,
-                            const UnstructuredGridCoordless &zug, std::shared_ptr<const QuadTreeRectangleP> qtr);
+                            const UnstructuredGridCoordless &zug, std::shared_ptr<const QuadTreeRectangleP> qtr, std::shared_ptr<const BVHRectangle> bvh = nullptr,
+                            CellLocator locator = QUADTREE);
 
     UnstructuredGridLayered(const std::vector<size_t> &vertexDims, const std::vector<size_t> &faceDims, const std::vector<size_t> &edgeDims, const std::vector<size_t> &bs,
                             const std::vector<float *> &blks, const int *vertexOnFace, const int *faceOnVertex, const int *faceOnFace,
                             Location location,    // node,face, edge
                             size_t maxVertexPerFace, size_t maxFacePerVertex, long nodeOffset, long cellOffset, const UnstructuredGridCoordless &xug, const UnstructuredGridCoordless &yug,
-                            const UnstructuredGridCoordless &zug, std::shared_ptr<const QuadTreeRectangleP> qtr);
+                            const UnstructuredGridCoordless &zug, std::shared_ptr<const QuadTreeRectangleP> qtr, std::shared_ptr<const BVHRectangle> bvh = nullptr,
+                            CellLocator locator = QUADTREE);
 
     UnstructuredGridLayered() = default;
     virtual ~UnstructuredGridLayered() = default;
 
     std::shared_ptr<const QuadTreeRectangleP> GetQuadTreeRectangle() const { return (_ug2d.GetQuadTreeRectangle()); }
 
+    //! Use a bounding volume hierarchy to locate cells
+    //!
+    //! Cells are located in the horizontal 2D mesh, so \p bvh must have
+    //! been built over its faces, e.g. by MakeBVHRectangle().
+    //!
+    //! \sa UnstructuredGrid2D::SetBVHRectangle()
+    //
+    void SetBVHRectangle(std::shared_ptr<const BVHRectangle> bvh) { _ug2d.SetBVHRectangle(bvh); }
+
+    std::shared_ptr<const BVHRectangle> GetBVHRectangle() const { return (_ug2d.GetBVHRectangle()); }
+
+    //! Build a bounding volume hierarchy over the faces of the horizontal
+    //! 2D mesh
+    //
+    std::shared_ptr<BVHRectangle> MakeBVHRectangle() const { return (_ug2d.MakeBVHRectangle()); }
+
     virtual DimsType GetCoordDimensions(size_t dim) const override;
 
     virtual size_t GetGeometryDim() const override;
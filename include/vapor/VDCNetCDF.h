@@ -183,6 +183,8 @@ protected:
     int readRegion(int fd, const std::vector<size_t> &min, const std::vector<size_t> &max, double *region);
     int readRegion(int fd, const std::vector<size_t> &min, const std::vector<size_t> &max, int *region);
 
+    int readRegionRange(int fd, const std::vector<size_t> &min, const std::vector<size_t> &max, std::vector<double> &range);
+
     virtual bool variableExists(size_t ts, string varname, int reflevel = 0, int lod = 0) const;
 
 private:
@@ -528,6 +528,31 @@ public:
     virtual int GetVaraBlock(vector<size_t> start, vector<size_t> count, int16_t *data);
     virtual int GetVaraBlock(vector<size_t> start, vector<size_t> count, unsigned char *data);
 
+    //! Return the range of values of a hyper-slab from stored block metadata
+    //!
+    //! The minimum and maximum data value of each storage block of a
+    //! compressed variable are recorded when the block is written. This
+    //! method returns the range of the blocks intersecting the
+    //! hyper-slab defined by \p start and \p count of the currently
+    //! opened variable, without reading or reconstructing any
+    //! wavelet coefficients. The range is exact if the hyper-slab
+    //! is block aligned, and otherwise is guaranteed to contain the
+    //! hyper-slab's range.
+    //!
+    //! \param[in] start Index of the first element of the hyper-slab. See
+    //! GetVara()
+    //! \param[in] count Edge lengths of the hyper-slab. See GetVara()
+    //! \param[out] range A two element vector containing the minimum and
+    //! maximum value, respectively
+    //!
+    //! \retval status Returns 1 on success, 0 if the opened variable is
+    //! not compressed and no block ranges are stored, or a negative value
+    //! on failure
+    //!
+    //! \sa GetVara(), OpenVarRead()
+    //
+    virtual int GetVaraRange(vector<size_t> start, vector<size_t> count, vector<double> &range);
+
     //! Read an array of values from the currently opened variable
     //!
     //! The currently opened variable may or may not be a WASP
@@ -48,14 +48,30 @@ void *operator new[](size_t sz)
 }
 #endif
 
-char *MyBase::ErrMsg = NULL;
-int   MyBase::ErrMsgSize = 0;
-int   MyBase::ErrCode = 0;
+namespace {
+
+// Message buffers are per thread so that concurrent callers do not
+// clobber each other's error state
+//
+struct msg_buf_t {
+    char *msg = NULL;
+    int   size = 0;
+    ~msg_buf_t()
+    {
+        if (msg) delete[] msg;
+    }
+};
+
+thread_local msg_buf_t ErrMsgBuf;
+thread_local int       ErrCode = 0;
+thread_local msg_buf_t DiagMsgBuf;
+thread_local bool      Enabled = true;
+
+};    // namespace
+
 FILE *MyBase::ErrMsgFilePtr = NULL;
 void (*MyBase::ErrMsgCB)(const char *msg, int err_code) = NULL;
 
-char *MyBase::DiagMsg = NULL;
-int   MyBase::DiagMsgSize = 0;
 #ifdef DEBUG
 FILE *MyBase::DiagMsgFilePtr = stderr;
 #else
@@ -63,7 +79,14 @@ FILE *MyBase::DiagMsgFilePtr = NULL;
 #endif
 void (*MyBase::DiagMsgCB)(const char *msg) = NULL;
 
-bool MyBase::Enabled = true;
+bool MyBase::EnableErrMsg(bool enable)
+{
+    bool prev = Enabled;
+    Enabled = enable;
+    return (prev);
+}
+
+bool MyBase::GetEnableErrMsg() { return (Enabled); }
 
 MyBase::MyBase() { SetClassName("MyBase"); }
 
@@ -125,12 +148,12 @@ void MyBase::SetErrMsg(const char *format, ...)
     ErrCode = 1;
 
     va_start(args, format);
-    _SetErrMsg(&ErrMsg, &ErrMsgSize, format, args);
+    _SetErrMsg(&ErrMsgBuf.msg, &ErrMsgBuf.size, format, args);
     va_end(args);
 
-    if (ErrMsgCB) (*ErrMsgCB)(ErrMsg, ErrCode);
+    if (ErrMsgCB) (*ErrMsgCB)(ErrMsgBuf.msg, ErrCode);
 
-    if (ErrMsgFilePtr) { (void)fprintf(ErrMsgFilePtr, "%s\n", ErrMsg); }
+    if (ErrMsgFilePtr) { (void)fprintf(ErrMsgFilePtr, "%s\n", ErrMsgBuf.msg); }
 }
 
 void MyBase::SetErrMsg(int errcode, const char *format, ...)
@@ -141,27 +164,35 @@ void MyBase::SetErrMsg(int errcode, const char *format, ...)
     ErrCode = errcode;
 
     va_start(args, format);
-    _SetErrMsg(&ErrMsg, &ErrMsgSize, format, args);
+    _SetErrMsg(&ErrMsgBuf.msg, &ErrMsgBuf.size, format, args);
     va_end(args);
 
-    if (ErrMsgCB) (*ErrMsgCB)(ErrMsg, ErrCode);
+    if (ErrMsgCB) (*ErrMsgCB)(ErrMsgBuf.msg, ErrCode);
 
-    if (ErrMsgFilePtr) { (void)fprintf(ErrMsgFilePtr, "%s\n", ErrMsg); }
+    if (ErrMsgFilePtr) { (void)fprintf(ErrMsgFilePtr, "%s\n", ErrMsgBuf.msg); }
 }
 
+const char *MyBase::GetErrMsg() { return (ErrMsgBuf.msg); }
+
+void MyBase::SetErrCode(int err_code) { ErrCode = err_code; }
+
+int MyBase::GetErrCode() { return (ErrCode); }
+
 void MyBase::SetDiagMsg(const char *format, ...)
 {
     va_list args;    // initialize to make valgrind shutup
 
     va_start(args, format);
-    _SetErrMsg(&DiagMsg, &DiagMsgSize, format, args);
+    _SetErrMsg(&DiagMsgBuf.msg, &DiagMsgBuf.size, format, args);
     va_end(args);
 
-    if (DiagMsgCB) (*DiagMsgCB)(DiagMsg);
+    if (DiagMsgCB) (*DiagMsgCB)(DiagMsgBuf.msg);
 
-    if (DiagMsgFilePtr) { (void)fprintf(DiagMsgFilePtr, "%s\n", DiagMsg); }
+    if (DiagMsgFilePtr) { (void)fprintf(DiagMsgFilePtr, "%s\n", DiagMsgBuf.msg); }
 }
 
+const char *MyBase::GetDiagMsg() { return (DiagMsgBuf.msg); }
+
 int Wasp::IsPowerOfTwo(unsigned int x)
 {
     if (!x) return 1;
@@ -522,9 +522,9 @@ const VAPoR::Grid *VaporField::_getAGrid(uint32_t timestep, const std::string &v
     // 2) ask for it from the data manager,
     //
 
-    // Note that we use a lock here, so no two threads querying _datamgr simultaneously.
-    const std::lock_guard<std::mutex> lock_gd(_grid_operation_mutex);
-
+    // DataMgr::GetVariable() is thread safe, so threads requesting different
+    // grids may load them concurrently. Only insertion into our cache is
+    // serialized, below.
     VAPoR::Grid *grid = nullptr;
     if (key.emptyVar()) {
         // In case of an empty variable name, we generate a constantGrid with zeros.
@@ -558,6 +558,16 @@ const VAPoR::Grid *VaporField::_getAGrid(uint32_t timestep, const std::string &v
         Wasp::MyBase::SetErrMsg("Variable Dimension Wrong!");
         return nullptr;
     }
+
+    // Another thread may have fetched the same grid while we were loading ours.
+    // If so, discard ours and use theirs.
+    const std::lock_guard<std::mutex> lock_gd(_grid_operation_mutex);
+    wrapper = _recentGrids.query(key);
+    if (wrapper != nullptr) {
+        _datamgr->UnlockGrid(grid);
+        delete grid;
+        return wrapper->grid();
+    }
     _recentGrids.insert(key, new GridWrapper(grid, _datamgr));
     return grid;
 }
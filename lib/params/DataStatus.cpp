@@ -59,6 +59,7 @@ DataStatus::DataStatus(size_t cacheSize, int nThreads)
 {
     _cacheSize = cacheSize;
     _nThreads = nThreads;
+    _cellLocator = UnstructuredGrid::QUADTREE;
 
     _dataMgrs.clear();
     _timeCoords.clear();
@@ -80,6 +81,12 @@ int DataStatus::Open(const std::vector<string> &files, const std::vector<string>
         dataMgr = new PythonDataMgr(format, _cacheSize, _nThreads);
     else
         dataMgr = new DataMgr(format, _cacheSize, _nThreads);
+    dataMgr->SetCellLocator(_cellLocator);
+
+    // A cache directory that can't be used only costs the time to
+    // rebuild the locators
+    //
+    if (!_locatorCacheDir.empty()) (void)dataMgr->SetLocatorCache(_locatorCacheDir);
 
     // Ensure all data managers use the same proj4 string. Note, it's
     // possible that 'options' will already have a -proj4 string argument.
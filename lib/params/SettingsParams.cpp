@@ -41,6 +41,8 @@ const string SettingsParams::_classType = "SettingsParams";
 const string SettingsParams::_shortName = "Settings";
 const string SettingsParams::_cacheMBTag = "CacheMBs";
 const string SettingsParams::_numThreadsTag = "NumThreads";
+const string SettingsParams::_useBVHCellLocatorTag = "UseBVHCellLocator";
+const string SettingsParams::_locatorCacheDirTag = "LocatorCacheDir";
 const string SettingsParams::_texSizeTag = "TexSize";
 const string SettingsParams::_texSizeEnableTag = "TexSizeEnabled";
 const string SettingsParams::_sessionDirTag = "SessionDir";
@@ -68,6 +70,7 @@ const string SettingsParams::_dontShowIntelDriverWarningTag = "DontShowIntelDriv
 const string SettingsParams::_settingsNeedsWriteTag = "SettingsNeedsWrite";
 
 const string SettingsParams::UseAllCoresTag = "UseAllCoresTag";
+const string SettingsParams::LocatorCacheEnabledTag = "LocatorCacheEnabled";
 const string SettingsParams::AutoCheckForUpdatesTag = "AutoCheckForUpdatesTag";
 const string SettingsParams::AutoCheckForNoticesTag = "AutoCheckForNoticesTag";
 const string SettingsParams::CasperVGLCheck = "CasperVGLCheck";
@@ -159,6 +162,23 @@ void SettingsParams::SetCacheMB(long val)
     SetValueLong(_cacheMBTag, "Set cache size", val);
 }
 
+bool SettingsParams::GetUseBVHCellLocator() const { return GetValueLong(_useBVHCellLocatorTag, false); }
+
+void SettingsParams::SetUseBVHCellLocator(bool val) { SetValueLong(_useBVHCellLocatorTag, "Use BVH cell locator", val); }
+
+bool SettingsParams::GetLocatorCacheEnabled() const { return GetValueLong(LocatorCacheEnabledTag, false); }
+
+void SettingsParams::SetLocatorCacheEnabled(bool val) { SetValueLong(LocatorCacheEnabledTag, "Enable cell locator cache", val); }
+
+string SettingsParams::GetLocatorCacheDir() const
+{
+    string dir = GetValueString(_locatorCacheDirTag, FileUtils::HomeDir());
+    _swapTildeWithHome(dir);
+    return (dir);
+}
+
+void SettingsParams::SetLocatorCacheDir(string dir) { SetValueString(_locatorCacheDirTag, "Set cell locator cache directory", dir); }
+
 long SettingsParams::GetTextureSize() const
 {
     long val = GetValueLong(_texSizeTag, 0);
@@ -480,6 +500,9 @@ void SettingsParams::Init()
     SetValueLong(AutoCheckForNoticesTag, "", true);
     SetNumThreads(4);
     SetCacheMB(defaultCacheSize);
+    SetUseBVHCellLocator(false);
+    SetLocatorCacheEnabled(false);
+    SetLocatorCacheDir(homeDir);
 
 
     SetDefaultSessionDir(string(homeDir));
@@ -21,6 +21,7 @@
 #include <sstream>
 #include <string>
 #include <iterator>
+#include <set>
 
 #include <vapor/glutil.h>    // Must be included first!!!
 
@@ -38,6 +39,7 @@
 #include <vapor/GLManager.h>
 #include <vapor/LegacyGL.h>
 #include <vapor/ArbitrarilyOrientedRegularGrid.h>
+#include <vapor/StructuredGrid.h>
 
 using namespace VAPoR;
 
@@ -210,6 +212,20 @@ int ContourRenderer::_buildCache(bool fast)
     double mv = grid->GetMissingValue();
     float  Z0 = GetDefaultZ(_dataMgr, _cacheParams.ts);
 
+    // For 2D structured grids skip the cells of blocks that can't contain
+    // any of the contour values
+    //
+    DimsType           blockSize = {1, 1, 1};
+    std::set<DimsType> activeBlocks;
+    bool               pruneBlocks = dims == 2 && dynamic_cast<StructuredGrid *>(grid);
+    for (int ci = 0; pruneBlocks && ci != contours.size(); ci++) {
+        vector<DimsType> blocks;
+        int              rc = _dataMgr->GetBlocksInValueRange(_cacheParams.ts, _cacheParams.varName, _cacheParams.level, _cacheParams.lod, contours[ci], contours[ci], blockSize, blocks);
+        if (rc < 0) pruneBlocks = false;
+        activeBlocks.insert(blocks.begin(), blocks.end());
+    }
+    DimsType minAbs = grid->GetMinAbs();
+
     Grid::ConstCellIterator it = grid->ConstCellBegin(boxMin, boxMax);
 
     size_t           maxNodes = grid->GetMaxVertexPerCell();
@@ -221,6 +237,8 @@ int ContourRenderer::_buildCache(bool fast)
     Grid::ConstCellIterator end = grid->ConstCellEnd();
     for (; it != end; ++it) {
         const DimsType &cell = *it;
+        if (pruneBlocks && !activeBlocks.count({(cell[0] + minAbs[0]) / blockSize[0], (cell[1] + minAbs[1]) / blockSize[1], 0})) continue;
+
         grid->GetCellNodes(cell, nodes);
 
         bool hasMissing = false;
@@ -32,6 +32,8 @@ ControlExec::ControlExec(ParamsMgr *pm, size_t cacheSizeMB, int nThreads) : MyBa
     auto sp = pm->GetParams<SettingsParams>();
     SetCacheSize(sp->GetCacheMB());
     SetNumThreads(sp->GetNumThreads());
+    _dataStatus->SetCellLocator(sp->GetUseBVHCellLocator() ? UnstructuredGrid::BVH : UnstructuredGrid::QUADTREE);
+    _dataStatus->SetLocatorCache(sp->GetLocatorCacheEnabled() ? sp->GetLocatorCacheDir() : "");
 }
 
 ControlExec::~ControlExec()
@@ -465,6 +467,46 @@ void ControlExec::CloseData(string dataSetName)
     _paramsMgr->EndSaveStateGroup();
 }
 
+void ControlExec::PrefetchTimesteps(const vector<size_t> &timesteps)
+{
+    vector<string> winNames = GetVisualizerNames();
+    vector<string> dataSetNames = _dataStatus->GetDataMgrNames();
+    for (const auto &dataSetName : dataSetNames) {
+        DataMgr *dataMgr = _dataStatus->GetDataMgr(dataSetName);
+        if (!dataMgr) continue;
+
+        for (const auto &winName : winNames) {
+            for (const auto &pClassName : _paramsMgr->GetRenderParamsClassNames(winName, dataSetName)) {
+                for (const auto &instName : _paramsMgr->GetRenderParamInstances(winName, dataSetName, pClassName)) {
+                    RenderParams *rParams = _paramsMgr->GetRenderParams(winName, dataSetName, pClassName, instName);
+                    if (!rParams || !rParams->IsEnabled()) continue;
+
+                    vector<string> varnames = rParams->GetFieldVariableNames();
+                    varnames.push_back(rParams->GetVariableName());
+                    varnames.push_back(rParams->GetColorMapVariableName());
+                    varnames.push_back(rParams->GetHeightVariableName());
+
+                    CoordType minExt, maxExt;
+                    rParams->GetBox()->GetExtents(minExt, maxExt);
+
+                    for (auto ts : timesteps) {
+                        size_t local_ts = _dataStatus->MapGlobalToLocalTimeStep(dataSetName, ts);
+                        (void)dataMgr->Prefetch(local_ts, varnames, rParams->GetRefinementLevel(), rParams->GetCompressionLevel(), minExt, maxExt);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void ControlExec::CancelPrefetch()
+{
+    for (const auto &dataSetName : _dataStatus->GetDataMgrNames()) {
+        DataMgr *dataMgr = _dataStatus->GetDataMgr(dataSetName);
+        if (dataMgr) dataMgr->CancelPrefetch();
+    }
+}
+
 int ControlExec::EnableImageCapture(string filename, string winName, bool fast)
 {
     Visualizer *v = getVisualizer(winName);
@@ -19,6 +19,7 @@
 #include <vapor/MyBase.h>
 #include <vapor/DataMgrUtils.h>
 #include <vapor/Histo.h>
+#include <vapor/GridTraversal.h>
 #include <cassert>
 using namespace VAPoR;
 using namespace Wasp;
@@ -337,14 +338,17 @@ vector<float> Histo::getDataSamplesIterating(const Grid *grid, const int stride)
     VAssert(grid);
     vector<float> samples;
 
-    float               missingValue = grid->GetMissingValue();
-    Grid::ConstIterator enditr = grid->cend();
+    // Keep every stride'th node in index order. The nodes are visited in
+    // block order, which doesn't matter for a histogram
+    //
+    float           missingValue = grid->GetMissingValue();
+    const DimsType &dims = grid->GetDimensions();
+
+    ForEachNode(*grid, [&](const DimsType &index, float v) {
+        size_t offset = index[0] + dims[0] * (index[1] + dims[1] * index[2]);
+        if (offset % stride == 0 && v != missingValue) samples.push_back(v);
+    });
 
-    for (auto itr = grid->cbegin(); itr != enditr; itr += stride) {
-        float v = *itr;
-        if (v != missingValue) samples.push_back(v);
-    }
-    
     return samples;
 }
 
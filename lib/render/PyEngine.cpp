@@ -384,6 +384,16 @@ int PyEngine::Calculate(const string &script, vector<string> inputVarNames, vect
 
     // cout << "PyEngine::Calculate() " << script << endl;
 
+    // The interpreter is initialized on, and its GIL held by, the main
+    // thread. The DataMgr keeps Python derived variables off its worker
+    // threads (see DerivedVar::IsThreadSafe()); refuse anything that
+    // slips through rather than corrupt the interpreter
+    //
+    if (!PyGILState_Check()) {
+        SetErrMsg("Python scripts may only be run on the thread holding the Python GIL");
+        return -1;
+    }
+
     // Convert the input arrays and put into dictionary:
     //
     PyObject *mainModule = PyImport_AddModule("__main__");
@@ -212,7 +212,19 @@ void ArbitrarilyOrientedRegularGrid::_populateData(
     float missingValue = grid->GetMissingValue();
     size_t index = 0;
 
+    // Sample a scanline at a time with Grid::GetValues(). Samples along a
+    // scanline are spatially coherent, which lets grids reuse the cell
+    // found for one sample when locating the next
+    //
+    std::vector<double> xyz;
+    std::vector<size_t> offsets;
+    std::vector<float>  values;
+    xyz.reserve(3 * _sideSize);
+    offsets.reserve(_sideSize);
+
     for (size_t j = 0; j < _sideSize; j++) {
+        xyz.clear();
+        offsets.clear();
         for (size_t i = 0; i < _sideSize; i++) {
             VAPoR::CoordType p;
             GetUserCoordinates({i,j,1}, p);
@@ -223,10 +235,15 @@ void ArbitrarilyOrientedRegularGrid::_populateData(
                 _myBlks[index] = missingValue;
             }
             else {
-                _myBlks[index] = grid->GetValue(p);
+                xyz.insert(xyz.end(), p.begin(), p.end());
+                offsets.push_back(index);
             }
             index++;
         }
+
+        values.resize(offsets.size());
+        grid->GetValues(xyz.data(), offsets.size(), values.data());
+        for (size_t n = 0; n < offsets.size(); n++) _myBlks[offsets[n]] = values[n];
     }
 }
 
@@ -12,8 +12,15 @@
 #include "vapor/utils.h"
 #include "vapor/FileUtils.h"
 #include <cstdio>
+#include <cstring>
 #include <climits>
 #include <cmath>
+#ifndef WIN32
+    #include <unistd.h>
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+#endif
 
 #include <vapor/BOVCollection.h>
 
@@ -72,6 +79,36 @@ size_t getFileSize(std::string filename)    // path to file
     fclose(p_file);
     return size;
 }
+
+// Convert count elements of type S starting at src, which need not be
+// aligned, into dst. Elements are copied verbatim when no conversion is
+// needed
+//
+template<class S, class T> void convertElements(const unsigned char *src, size_t count, T *dst)
+{
+    if (std::is_same<S, T>::value) {
+        memcpy(dst, src, count * sizeof(T));
+        return;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        S v;
+        memcpy(&v, src + i * sizeof(S), sizeof(S));
+        dst[i] = (T)v;
+    }
+}
+
+// As above, with the source element type given by a BOV data format
+//
+template<class T> void convertElements(const unsigned char *src, DC::XType format, size_t count, T *dst)
+{
+    switch (format) {
+    case DC::XType::INT32: convertElements<int>(src, count, dst); break;
+    case DC::XType::FLOAT: convertElements<float>(src, count, dst); break;
+    case DC::XType::DOUBLE: convertElements<double>(src, count, dst); break;
+    default: break;
+    }
+}
 }    // namespace
 
 BOVCollection::BOVCollection()
@@ -538,11 +575,113 @@ int BOVCollection::_sizeOfFormat(DC::XType type) const
     }
 }
 
+#ifndef WIN32
+template<class T> bool BOVCollection::_readRegionMapped(const std::string &dataFile, const std::vector<size_t> &min, const std::vector<size_t> &max, T region) const
+{
+    typedef typename std::remove_pointer<T>::type elem_t;
+
+    int formatSize = _sizeOfFormat(_dataFormat);
+
+    // Byte range of the file spanned by the region, with the start rounded
+    // down to a page boundary as required by mmap
+    //
+    size_t first = min[0] + _gridSize[0] * (min[1] + _gridSize[1] * min[2]);
+    size_t last = max[0] + _gridSize[0] * (max[1] + _gridSize[1] * max[2]);
+    size_t begin = _byteOffset + formatSize * first;
+    size_t end = _byteOffset + formatSize * (last + 1);
+    size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+    size_t mapOffset = begin - (begin % pageSize);
+    size_t mapLength = end - mapOffset;
+
+    // Sparse rows, e.g. a narrow column through a large volume, would
+    // fault in whole pages for a few elements each. Leave them to the
+    // stream reader, which only reads the bytes needed
+    //
+    size_t count = max[0] - min[0] + 1;
+    size_t nbytes = formatSize * count * (max[1] - min[1] + 1) * (max[2] - min[2] + 1);
+    if (nbytes < mapLength / 4) return (false);
+
+    int fd = open(dataFile.c_str(), O_RDONLY);
+    if (fd < 0) return (false);
+
+    struct stat statbuf;
+    if (fstat(fd, &statbuf) < 0 || (size_t)statbuf.st_size < end) {
+        close(fd);
+        return (false);
+    }
+
+    void *addr = mmap(NULL, mapLength, PROT_READ, MAP_PRIVATE, fd, (off_t)mapOffset);
+    close(fd);
+    if (addr == MAP_FAILED) return (false);
+
+    const unsigned char *base = (const unsigned char *)addr - mapOffset;
+
+    // Runs of elements to copy, in file order. Rows that are adjacent in
+    // the file (e.g. when the region spans the full X, or X and Y,
+    // extents) are coalesced into a single run. A run of zero elements
+    // marks the end
+    //
+    size_t j = min[1], k = min[2];
+    auto   nextRun = [&]() {
+        std::pair<size_t, size_t> run = {0, 0};
+        for (; k <= max[2]; k++, j = min[1]) {
+            for (; j <= max[1]; j++) {
+                size_t index = min[0] + _gridSize[0] * (j + _gridSize[1] * k);
+                if (run.second && index != run.first + run.second) return (run);
+                if (!run.second) run.first = index;
+                run.second += count;
+            }
+        }
+        return (run);
+    };
+
+    // Ask the kernel to read the pages of the next run while the current
+    // one is copied. Only the pages of runs are advised, not the gaps
+    // between them. Runs shorter than a page are left to the kernel's
+    // fault-around
+    //
+    auto willNeed = [&](const std::pair<size_t, size_t> &run) {
+        if (formatSize * run.second < pageSize) return;
+        size_t runBegin = _byteOffset + formatSize * run.first;
+        size_t runEnd = _byteOffset + formatSize * (run.first + run.second);
+        runBegin = std::max(runBegin - (runBegin % pageSize), mapOffset);
+        (void)madvise((void *)(base + runBegin), runEnd - runBegin, MADV_WILLNEED);
+    };
+
+    elem_t *                  dst = region;
+    std::pair<size_t, size_t> run = nextRun();
+    willNeed(run);
+    while (run.second) {
+        std::pair<size_t, size_t> next = nextRun();
+        willNeed(next);
+        convertElements(base + _byteOffset + formatSize * run.first, _dataFormat, run.second, dst);
+        dst += run.second;
+        run = next;
+    }
+
+    munmap(addr, mapLength);
+    return (true);
+}
+#endif
+
 template<class T> int BOVCollection::ReadRegion(std::string varname, size_t ts, const std::vector<size_t> &min, const std::vector<size_t> &max, T region)
 {
     float       time = _times[ts];
     std::string dataFile = _dataFileMap[varname][time];
 
+    int formatSize = _sizeOfFormat(_dataFormat);
+    if (formatSize < 0) {
+        SetErrMsg("Unspecified data format");
+        return -1;
+    }
+
+#ifndef WIN32
+    // Read through a memory mapping of the file when possible. Failures
+    // fall through to the stream reader below, which reports them
+    //
+    if (_readRegionMapped(dataFile, min, max, region)) return 0;
+#endif
+
     FILE *fp = fopen(dataFile.c_str(), "rb");
     if (!fp) {
         if (dataFile == "")
@@ -552,13 +691,6 @@ template<class T> int BOVCollection::ReadRegion(std::string varname, size_t ts,
         return -1;
     }
 
-    int formatSize = _sizeOfFormat(_dataFormat);
-    if (formatSize < 0) {
-        SetErrMsg("Unspecified data format");
-        fclose(fp);
-        return -1;
-    }
-
     // Read a "pencil" of data along the X axis, one row at a time
     size_t count = max[0] - min[0] + 1;
     // Note: allocate buffer once and reuse for many times, so repeated allocation is avoided.
@@ -575,6 +707,7 @@ template<class T> int BOVCollection::ReadRegion(std::string varname, size_t ts,
             int rc = fseek(fp, offset, SEEK_SET);
             if (rc != 0) {
                 MyBase::SetErrMsg("Unable to seek on file: %M");
+                fclose(fp);
                 return -1;
             }
 
@@ -589,16 +722,8 @@ template<class T> int BOVCollection::ReadRegion(std::string varname, size_t ts,
                 return -1;
             }
 
-            if (_dataFormat == DC::XType::INT32) {
-                int *castBuffer = (int *)readBuffer;
-                for (size_t i = 0; i < count; i++) { *region++ = (typename std::remove_pointer<T>::type)castBuffer[i]; }
-            } else if (_dataFormat == DC::XType::FLOAT) {
-                float *castBuffer = (float *)readBuffer;
-                for (size_t i = 0; i < count; i++) { *region++ = (typename std::remove_pointer<T>::type)castBuffer[i]; }
-            } else if (_dataFormat == DC::XType::DOUBLE) {
-                double *castBuffer = (double *)readBuffer;
-                for (size_t i = 0; i < count; i++) { *region++ = (typename std::remove_pointer<T>::type)castBuffer[i]; }
-            }
+            convertElements(readBuffer, _dataFormat, count, region);
+            region += count;
         }
     }
 
@@ -0,0 +1,557 @@
+#include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vapor/VAssert.h>
+#include <vapor/utils.h>
+#include <vapor/BVHRectangle.h>
+#include <vapor/OpenMPSupport.h>
+
+using namespace VAPoR;
+using namespace std;
+
+namespace {
+
+using rectangle_t = BVHRectangle::rectangle_t;
+using payload_t = BVHRectangle::payload_t;
+
+// Number of bins used to evaluate candidate SAH splits along each axis
+//
+const int nBins = 16;
+
+// Nodes with more rectangles than this are always split, even if the SAH
+// says otherwise
+//
+const size_t maxLeafSize = 16;
+
+// Subtrees with more rectangles than this are built by their own task
+//
+const size_t taskSize = 4096;
+
+rectangle_t emptyRectangle()
+{
+    float max = std::numeric_limits<float>::max();
+    return (rectangle_t(max, max, -max, -max));
+}
+
+void grow(rectangle_t &r, const rectangle_t &other)
+{
+    r._left = std::min(r._left, other._left);
+    r._top = std::min(r._top, other._top);
+    r._right = std::max(r._right, other._right);
+    r._bottom = std::max(r._bottom, other._bottom);
+}
+
+// The 2D analog of surface area: half of the perimeter
+//
+double halfPerimeter(const rectangle_t &r)
+{
+    if (r._left > r._right) return (0.0);
+    return (((double)r._right - r._left) + ((double)r._bottom - r._top));
+}
+
+// Convert to float, rounding outwards so rectangles never shrink
+//
+float roundDown(double v)
+{
+    float f = (float)v;
+    if (f > v) f = std::nextafter(f, -std::numeric_limits<float>::max());
+    return (f);
+}
+
+float roundUp(double v)
+{
+    float f = (float)v;
+    if (f < v) f = std::nextafter(f, std::numeric_limits<float>::max());
+    return (f);
+}
+
+// Node of the tree under construction. Children are allocated in pairs,
+// 'child' is the index of the first of them, or zero for a leaf. Leaves
+// reference the range [begin, end) of the rectangle order array
+//
+struct buildNode_t {
+    rectangle_t bounds;
+    uint32_t    begin;
+    uint32_t    end;
+    uint32_t    child;
+};
+
+class builder_t {
+public:
+    builder_t(const vector<rectangle_t> &rectangles, size_t leafSize) : _rectangles(rectangles), _leafSize(leafSize), _nodes(2 * rectangles.size()), _order(rectangles.size()), _cx(rectangles.size()), _cy(rectangles.size())
+    {
+        for (size_t i = 0; i < _rectangles.size(); i++) {
+            _order[i] = i;
+            _cx[i] = 0.5f * (_rectangles[i]._left + _rectangles[i]._right);
+            _cy[i] = 0.5f * (_rectangles[i]._top + _rectangles[i]._bottom);
+        }
+        _nextNode = 1;
+    }
+
+    void Build()
+    {
+        if (_rectangles.empty()) return;
+
+#pragma omp parallel
+#pragma omp single
+        _build(0, 0, _rectangles.size());
+    }
+
+    const vector<buildNode_t> &Nodes() const { return (_nodes); }
+    const vector<uint32_t> &   Order() const { return (_order); }
+
+private:
+    const vector<rectangle_t> &_rectangles;
+    size_t                     _leafSize;
+    vector<buildNode_t>        _nodes;
+    vector<uint32_t>           _order;
+    vector<float>              _cx;
+    vector<float>              _cy;
+    std::atomic<uint32_t>      _nextNode;
+
+    float _centroid(uint32_t r, int axis) const { return (axis == 0 ? _cx[r] : _cy[r]); }
+
+    static int _bin(float c, float cmin, float scale) { return (std::min(nBins - 1, (int)((c - cmin) * scale))); }
+
+    void _build(uint32_t nodeIdx, uint32_t begin, uint32_t end)
+    {
+        buildNode_t &node = _nodes[nodeIdx];
+        node.begin = begin;
+        node.end = end;
+        node.child = 0;
+
+        // Bounds of the rectangles, and of their centroids
+        //
+        rectangle_t bounds = emptyRectangle();
+        rectangle_t cbounds = emptyRectangle();
+        for (uint32_t i = begin; i < end; i++) {
+            uint32_t r = _order[i];
+            grow(bounds, _rectangles[r]);
+            grow(cbounds, rectangle_t(_cx[r], _cy[r], _cx[r], _cy[r]));
+        }
+        node.bounds = bounds;
+
+        size_t n = end - begin;
+        if (n <= _leafSize) return;
+
+        // Evaluate the SAH cost of splitting between each pair of adjacent
+        // bins along each axis. The cost of a leaf is the number of
+        // rectangles it holds, and the cost of traversing a node is one
+        //
+        double area = halfPerimeter(bounds);
+        if (area <= 0.0) area = 1.0;
+
+        int    bestAxis = -1;
+        int    bestBin = 0;
+        double bestCost = (double)n;
+        float  cmin[] = {cbounds._left, cbounds._top};
+        float  cmax[] = {cbounds._right, cbounds._bottom};
+        for (int axis = 0; axis < 2; axis++) {
+            if (!(cmax[axis] > cmin[axis])) continue;
+            float scale = nBins / (cmax[axis] - cmin[axis]);
+
+            size_t      counts[nBins] = {0};
+            rectangle_t binBounds[nBins];
+            for (int b = 0; b < nBins; b++) binBounds[b] = emptyRectangle();
+            for (uint32_t i = begin; i < end; i++) {
+                uint32_t r = _order[i];
+                int      b = _bin(_centroid(r, axis), cmin[axis], scale);
+                counts[b]++;
+                grow(binBounds[b], _rectangles[r]);
+            }
+
+            // Sweep from the right to get the cost of the right side of
+            // each split, then from the left
+            //
+            double      rightCost[nBins];
+            rectangle_t acc = emptyRectangle();
+            size_t      count = 0;
+            for (int b = nBins - 1; b > 0; b--) {
+                grow(acc, binBounds[b]);
+                count += counts[b];
+                rightCost[b] = count * halfPerimeter(acc);
+            }
+
+            acc = emptyRectangle();
+            count = 0;
+            for (int b = 0; b < nBins - 1; b++) {
+                grow(acc, binBounds[b]);
+                count += counts[b];
+                if (count == 0 || count == n) continue;
+
+                double cost = 1.0 + (count * halfPerimeter(acc) + rightCost[b + 1]) / area;
+                if (cost < bestCost || (bestAxis < 0 && n > maxLeafSize)) {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestBin = b;
+                }
+            }
+        }
+
+        if (bestAxis < 0 && n <= maxLeafSize) return;
+
+        uint32_t mid;
+        if (bestAxis < 0) {
+            // All centroids coincide. Split the range in half
+            //
+            mid = begin + n / 2;
+        } else {
+            float axisMin = cmin[bestAxis];
+            float scale = nBins / (cmax[bestAxis] - cmin[bestAxis]);
+            int   axis = bestAxis;
+            int   bin = bestBin;
+            mid = std::partition(_order.begin() + begin, _order.begin() + end, [&](uint32_t r) { return (_bin(_centroid(r, axis), axisMin, scale) <= bin); }) - _order.begin();
+            if (mid == begin || mid == end) mid = begin + n / 2;
+        }
+
+        uint32_t child = _nextNode.fetch_add(2);
+        node.child = child;
+
+        if (n > taskSize) {
+#pragma omp task
+            _build(child, begin, mid);
+            _build(child + 1, mid, end);
+#pragma omp taskwait
+        } else {
+            _build(child, begin, mid);
+            _build(child + 1, mid, end);
+        }
+    }
+};
+
+};    // namespace
+
+BVHRectangle::BVHRectangle(size_t leaf_size) : _leafSize(std::max(leaf_size, (size_t)1)), _maxDepth(0) {}
+
+void BVHRectangle::Build(const std::vector<rectangle_t> &rectangles, const std::vector<payload_t> &payloads)
+{
+    VAssert(rectangles.size() == payloads.size());
+
+    vector<rectangle_t> r = rectangles;
+    vector<payload_t>   p = payloads;
+    _build(r, p);
+}
+
+void BVHRectangle::Build(const Grid *grid, size_t ncells)
+{
+    if (ncells == 0) { ncells = Wasp::VProduct(grid->GetCellDimensions().data(), grid->GetNumCellDimensions()); }
+
+    vector<rectangle_t> rectangles(ncells, emptyRectangle());
+    vector<payload_t>   payloads(ncells);
+
+    int ncellindices = grid->GetNumCellDimensions();
+
+    // Each thread computes the bounding rectangles of a contiguous range
+    // of cells. Cells with fewer than two nodes are left empty, and
+    // dropped below
+    //
+#pragma omp parallel
+    {
+        size_t           maxNodes = grid->GetMaxVertexPerCell();
+        vector<DimsType> nodes(maxNodes);
+
+        int    id = omp_get_thread_num();
+        int    nthreads = omp_get_num_threads();
+        size_t istart = id * ncells / nthreads;
+        size_t iend = (id + 1) * ncells / nthreads;
+        if (id == nthreads - 1) iend = ncells;
+
+        CoordType               coords;
+        Grid::ConstCellIterator itr = grid->ConstCellBegin() + istart;
+
+        for (size_t i = istart; i < iend; i++, ++itr) {
+            DimsType cell = {0, 0, 0};
+            Grid::CopyToArr3((*itr).data(), ncellindices, cell);
+
+            grid->GetCellNodes(cell, nodes);
+            if (nodes.size() < 2) continue;
+
+            grid->GetUserCoordinates(nodes[0], coords);
+            double left = coords[0], right = coords[0];
+            double top = coords[1], bottom = coords[1];
+            for (int j = 1; j < nodes.size(); j++) {
+                grid->GetUserCoordinates(nodes[j], coords);
+                left = std::min(left, coords[0]);
+                right = std::max(right, coords[0]);
+                top = std::min(top, coords[1]);
+                bottom = std::max(bottom, coords[1]);
+            }
+
+            rectangles[i] = rectangle_t(roundDown(left), roundDown(top), roundUp(right), roundUp(bottom));
+            payloads[i] = {(uint32_t)cell[0], (uint32_t)cell[1]};
+        }
+    }
+
+    size_t n = 0;
+    for (size_t i = 0; i < ncells; i++) {
+        if (rectangles[i]._left > rectangles[i]._right) continue;
+        rectangles[n] = rectangles[i];
+        payloads[n] = payloads[i];
+        n++;
+    }
+    rectangles.resize(n);
+    payloads.resize(n);
+
+    _build(rectangles, payloads);
+}
+
+void BVHRectangle::_build(std::vector<rectangle_t> &rectangles, std::vector<payload_t> &payloads)
+{
+    VAssert(rectangles.size() < std::numeric_limits<uint32_t>::max() / 2);
+
+    _nodes.clear();
+    _rectangles.clear();
+    _payloads.clear();
+    _maxDepth = 0;
+    if (rectangles.empty()) return;
+
+    builder_t builder(rectangles, _leafSize);
+    builder.Build();
+
+    const vector<buildNode_t> &bnodes = builder.Nodes();
+    const vector<uint32_t> &   order = builder.Order();
+
+    // Flatten the tree in depth first order, so that the left child of
+    // every interior node follows it, and gather the rectangles and
+    // payloads in leaf order
+    //
+    _rectangles.reserve(rectangles.size());
+    _payloads.reserve(payloads.size());
+
+    struct item_t {
+        uint32_t bnode;
+        uint32_t depth;
+        long     parent;    // Interior node whose right child this is, or -1
+    };
+    vector<item_t> stack = {{0, 0, -1}};
+    while (!stack.empty()) {
+        item_t item = stack.back();
+        stack.pop_back();
+
+        const buildNode_t &bnode = bnodes[item.bnode];
+        if (item.parent >= 0) _nodes[item.parent].offset = _nodes.size();
+        _maxDepth = std::max(_maxDepth, (size_t)item.depth);
+
+        node_t node;
+        node.bounds = bnode.bounds;
+        if (bnode.child) {
+            node.offset = 0;
+            node.count = 0;
+            stack.push_back({bnode.child + 1, item.depth + 1, (long)_nodes.size()});
+            stack.push_back({bnode.child, item.depth + 1, -1});
+        } else {
+            node.offset = _rectangles.size();
+            node.count = bnode.end - bnode.begin;
+            for (uint32_t i = bnode.begin; i < bnode.end; i++) {
+                _rectangles.push_back(rectangles[order[i]]);
+                _payloads.push_back(payloads[order[i]]);
+            }
+        }
+        _nodes.push_back(node);
+    }
+}
+
+template<class F> void BVHRectangle::_forEachContaining(float x, float y, F f) const
+{
+    if (_nodes.empty()) return;
+
+    // The stack holds the right children of the interior nodes on the
+    // path to the current node, so it never exceeds the tree depth
+    //
+    uint32_t         localStack[64];
+    vector<uint32_t> heapStack;
+    uint32_t *       stack = localStack;
+    if (_maxDepth >= 64) {
+        heapStack.resize(_maxDepth + 1);
+        stack = heapStack.data();
+    }
+
+    size_t   sp = 0;
+    uint32_t idx = 0;
+    while (true) {
+        const node_t &node = _nodes[idx];
+        if (node.bounds.contains(x, y)) {
+            if (!node.count) {
+                stack[sp++] = node.offset;
+                idx++;
+                continue;
+            }
+            for (uint32_t i = node.offset; i < node.offset + node.count; i++) {
+                if (_rectangles[i].contains(x, y)) f(_payloads[i]);
+            }
+        }
+        if (sp == 0) break;
+        idx = stack[--sp];
+    }
+}
+
+void BVHRectangle::GetPayloadContained(float x, float y, std::vector<DimsType> &payloads) const
+{
+    payloads.clear();
+    _forEachContaining(x, y, [&payloads](const payload_t &p) { payloads.push_back(DimsType{p[0], p[1], 0}); });
+}
+
+void BVHRectangle::GetPayloadContained(const double *xy, size_t n, std::vector<size_t> &offsets, std::vector<DimsType> &payloads) const
+{
+    offsets.resize(n + 1);
+    payloads.clear();
+
+    // Each thread queries a contiguous range of points into its own
+    // payload list. The lists are then concatenated in order
+    //
+    int nthreads = 1;
+#pragma omp parallel
+    {
+        if (omp_get_thread_num() == 0) nthreads = omp_get_num_threads();
+    }
+
+    vector<vector<DimsType>> parPayloads(nthreads);
+
+#pragma omp parallel for schedule(static, 1)
+    for (int t = 0; t < nthreads; t++) {
+        size_t            istart = t * n / nthreads;
+        size_t            iend = (t + 1) * n / nthreads;
+        vector<DimsType> &p = parPayloads[t];
+        for (size_t i = istart; i < iend; i++) {
+            offsets[i] = p.size();
+            _forEachContaining((float)xy[2 * i], (float)xy[2 * i + 1], [&p](const payload_t &q) { p.push_back(DimsType{q[0], q[1], 0}); });
+        }
+    }
+
+    size_t total = 0;
+    for (int t = 0; t < nthreads; t++) total += parPayloads[t].size();
+    payloads.reserve(total);
+
+    for (int t = 0; t < nthreads; t++) {
+        size_t istart = t * n / nthreads;
+        size_t iend = (t + 1) * n / nthreads;
+        size_t base = payloads.size();
+        for (size_t i = istart; i < iend; i++) offsets[i] += base;
+        payloads.insert(payloads.end(), parPayloads[t].begin(), parPayloads[t].end());
+    }
+    offsets[n] = payloads.size();
+}
+
+void BVHRectangle::GetPayloadIntersected(float left, float top, float right, float bottom, std::vector<DimsType> &payloads) const
+{
+    payloads.clear();
+    if (_nodes.empty()) return;
+
+    rectangle_t      r(left, top, right, bottom);
+    vector<uint32_t> stack = {0};
+    while (!stack.empty()) {
+        const node_t &node = _nodes[stack.back()];
+        uint32_t      idx = stack.back();
+        stack.pop_back();
+
+        if (!node.bounds.intersects(r)) continue;
+
+        if (!node.count) {
+            stack.push_back(node.offset);
+            stack.push_back(idx + 1);
+            continue;
+        }
+        for (uint32_t i = node.offset; i < node.offset + node.count; i++) {
+            if (_rectangles[i].intersects(r)) payloads.push_back(DimsType{_payloads[i][0], _payloads[i][1], 0});
+        }
+    }
+}
+
+void BVHRectangle::GetStats(std::vector<size_t> &payload_histo, std::vector<size_t> &level_histo) const
+{
+    payload_histo.clear();
+    level_histo.clear();
+    if (_nodes.empty()) return;
+
+    vector<std::pair<uint32_t, size_t>> stack = {{0, 0}};
+    while (!stack.empty()) {
+        uint32_t idx = stack.back().first;
+        size_t   depth = stack.back().second;
+        stack.pop_back();
+
+        const node_t &node = _nodes[idx];
+        if (!node.count) {
+            stack.push_back({node.offset, depth + 1});
+            stack.push_back({idx + 1, depth + 1});
+            continue;
+        }
+
+        if (node.count >= payload_histo.size()) payload_histo.resize(node.count + 1, 0);
+        payload_histo[node.count] += 1;
+
+        if (depth >= level_histo.size()) level_histo.resize(depth + 1, 0);
+        level_histo[depth] += 1;
+    }
+}
+
+void BVHRectangle::Serialize(std::vector<unsigned char> &buf) const
+{
+    uint64_t header[] = {(uint64_t)_leafSize, (uint64_t)_nodes.size(), (uint64_t)_rectangles.size()};
+
+    size_t offset = buf.size();
+    buf.resize(offset + sizeof(header) + _nodes.size() * sizeof(node_t) + _rectangles.size() * (sizeof(rectangle_t) + sizeof(payload_t)));
+    unsigned char *ptr = buf.data() + offset;
+
+    memcpy(ptr, header, sizeof(header));
+    ptr += sizeof(header);
+    if (_nodes.size()) memcpy(ptr, _nodes.data(), _nodes.size() * sizeof(node_t));
+    ptr += _nodes.size() * sizeof(node_t);
+    if (_rectangles.size()) memcpy(ptr, _rectangles.data(), _rectangles.size() * sizeof(rectangle_t));
+    ptr += _rectangles.size() * sizeof(rectangle_t);
+    if (_payloads.size()) memcpy(ptr, _payloads.data(), _payloads.size() * sizeof(payload_t));
+}
+
+bool BVHRectangle::Deserialize(const unsigned char *buf, size_t nbytes)
+{
+    uint64_t header[3];
+    if (nbytes < sizeof(header)) return (false);
+    memcpy(header, buf, sizeof(header));
+
+    uint64_t nnodes = header[1];
+    uint64_t nrects = header[2];
+    if (nnodes > nbytes / sizeof(node_t) || nrects > nbytes / sizeof(rectangle_t)) return (false);
+    if (nbytes != sizeof(header) + nnodes * sizeof(node_t) + nrects * (sizeof(rectangle_t) + sizeof(payload_t))) return (false);
+
+    const unsigned char *ptr = buf + sizeof(header);
+    vector<node_t>       nodes(nnodes);
+    vector<rectangle_t>  rectangles(nrects);
+    vector<payload_t>    payloads(nrects);
+    if (nnodes) memcpy(nodes.data(), ptr, nnodes * sizeof(node_t));
+    ptr += nnodes * sizeof(node_t);
+    if (nrects) memcpy(rectangles.data(), ptr, nrects * sizeof(rectangle_t));
+    ptr += nrects * sizeof(rectangle_t);
+    if (nrects) memcpy(payloads.data(), ptr, nrects * sizeof(payload_t));
+
+    // Check the links, which must point forward, and recompute the depth
+    // of the tree
+    //
+    size_t maxDepth = 0;
+    if (nnodes) {
+        vector<std::pair<uint32_t, size_t>> stack = {{0, 0}};
+        while (!stack.empty()) {
+            uint32_t idx = stack.back().first;
+            size_t   depth = stack.back().second;
+            stack.pop_back();
+
+            const node_t &node = nodes[idx];
+            maxDepth = std::max(maxDepth, depth);
+            if (!node.count) {
+                if (node.offset <= idx + 1 || node.offset >= nnodes) return (false);
+                stack.push_back({node.offset, depth + 1});
+                stack.push_back({idx + 1, depth + 1});
+            } else if (node.offset > nrects || node.count > nrects - node.offset) {
+                return (false);
+            }
+        }
+    }
+
+    _leafSize = header[0];
+    _maxDepth = maxDepth;
+    _nodes = std::move(nodes);
+    _rectangles = std::move(rectangles);
+    _payloads = std::move(payloads);
+    return (true);
+}
@@ -24,9 +24,12 @@ bool   BlkMemMgr::_page_aligned = false;
 size_t BlkMemMgr::_mem_size_max = 0;
 size_t BlkMemMgr::_blk_size = 0;
 
-vector<size_t>                               BlkMemMgr::_mem_region_sizes;
-vector<unsigned char *>                      BlkMemMgr::_blks;
-vector<vector<BlkMemMgr::_mem_allocation_t>> BlkMemMgr::_mem_regions;
+map<unsigned char *, BlkMemMgr::_mem_run_t>   BlkMemMgr::_free_by_addr;
+set<pair<size_t, unsigned char *>>            BlkMemMgr::_free_by_size;
+unordered_map<void *, BlkMemMgr::_mem_run_t>  BlkMemMgr::_used;
+vector<size_t>                                BlkMemMgr::_mem_region_sizes;
+vector<unsigned char *>                       BlkMemMgr::_blks;
+std::mutex                                    BlkMemMgr::_mutex;
 #ifdef VAPOR3_0_0_ALPHA
 #endif
 
@@ -53,7 +56,7 @@ int BlkMemMgr::_Reinit(size_t n)
     //
     size_t total_size = 0;
     int    r;
-    for (r = 0; r < _mem_regions.size(); r++) total_size += _mem_region_sizes[r];
+    for (r = 0; r < _mem_region_sizes.size(); r++) total_size += _mem_region_sizes[r];
 
     //
     // New region size is double preceding one
@@ -99,20 +102,38 @@ int BlkMemMgr::_Reinit(size_t n)
 
     if (page_size) { blkptr += page_size - (((size_t)blks) % page_size); }
 
-    _mem_allocation_t         m;
-    vector<_mem_allocation_t> mem_region;
-    m._nfree = mem_size;
-    m._nused = 0;
-    m._blk = blkptr;
-    mem_region.push_back(m);
+    _insert_free(blkptr, {mem_size, (int)_blks.size()});
 
-    _mem_regions.push_back(mem_region);
     _blks.push_back(blks);
     _mem_region_sizes.push_back(mem_size);
 
     return (true);
 }
 
+void BlkMemMgr::_insert_free(unsigned char *blk, _mem_run_t run)
+{
+    _free_by_addr[blk] = run;
+    _free_by_size.insert(make_pair(run._nblks, blk));
+}
+
+void BlkMemMgr::_erase_free(map<unsigned char *, _mem_run_t>::iterator itr)
+{
+    _free_by_size.erase(make_pair(itr->second._nblks, itr->first));
+    _free_by_addr.erase(itr);
+}
+
+void BlkMemMgr::_free_pool()
+{
+    for (int i = 0; i < _blks.size(); i++) {
+        if (_blks[i]) delete[] _blks[i];
+    }
+    _blks.clear();
+    _mem_region_sizes.clear();
+    _free_by_addr.clear();
+    _free_by_size.clear();
+    _used.clear();
+}
+
 int BlkMemMgr::RequestMemSize(size_t blk_size, size_t num_blks, bool page_aligned)
 {
     SetDiagMsg("BlkMemMgr::RequestMemSize(%u,%u,%d)", blk_size, num_blks, page_aligned);
@@ -126,6 +147,8 @@ int BlkMemMgr::RequestMemSize(size_t blk_size, size_t num_blks, bool page_aligne
         return (-1);
     }
 
+    std::unique_lock<std::mutex> guard(_mutex);
+
     _blk_size_req = blk_size;
     _mem_size_max_req = num_blks;
     _page_aligned_req = page_aligned;
@@ -137,6 +160,8 @@ BlkMemMgr::BlkMemMgr()
 {
     SetDiagMsg("BlkMemMgr::BlkMemMgr()");
 
+    std::unique_lock<std::mutex> guard(_mutex);
+
     //
     // If there are no other instances of this object, re-initialized
     // the static memory pool if needed
@@ -146,12 +171,7 @@ BlkMemMgr::BlkMemMgr()
         return;
     }
 
-    for (int i = 0; i < _blks.size(); i++) {
-        if (_blks[i]) delete[] _blks[i];
-    }
-    _mem_regions.clear();
-    _mem_region_sizes.clear();
-    _blks.clear();
+    _free_pool();
 
     _page_aligned = _page_aligned_req;
     _mem_size_max = _mem_size_max_req;
@@ -164,62 +184,53 @@ BlkMemMgr::~BlkMemMgr()
 {
     SetDiagMsg("BlkMemMgr::~BlkMemMgr()");
 
+    std::unique_lock<std::mutex> guard(_mutex);
+
     if (_ref_count > 0) _ref_count--;
 
     if (_ref_count != 0) return;
 
-    for (int i = 0; i < _blks.size(); i++) {
-        if (_blks[i]) delete[] _blks[i];
-    }
-    _blks.clear();
-    _mem_regions.clear();
-    _mem_region_sizes.clear();
+    _free_pool();
 }
 
 void *BlkMemMgr::Alloc(size_t n, bool fill)
 {
     SetDiagMsg("BlkMemMgr::Alloc(%d)", n);
 
+    if (n == 0) n = 1;
+
+    std::unique_lock<std::mutex> guard(_mutex);
+
     //
-    // Check each region, find the first run of blocks large enough
-    // to satisfy the request
+    // Find the smallest run of free blocks large enough to satisfy
+    // the request
     //
-    void *blk = NULL;
-    for (int r = 0; r < _mem_regions.size() && !blk; r++) {
-        vector<_mem_allocation_t> &mem_region = _mem_regions[r];
-        for (int i = 0; i < mem_region.size() && !blk; i++) {
-            if (n <= mem_region[i]._nfree) {    // Found a run of blocks
-                blk = mem_region[i]._blk;
-                mem_region[i]._nused = n;
-
-                //
-                // If run is strictly larger than request split it
-                //
-                if (n < mem_region[i]._nfree) {
-                    _mem_allocation_t m;
-                    m._nfree = mem_region[i]._nfree - n;
-                    m._nused = 0;
-                    m._blk = (unsigned char *)mem_region[i]._blk + (_blk_size * n);
-                    mem_region.insert(mem_region.begin() + i + 1, m);
-                }
-                mem_region[i]._nfree = 0;
-            }
-        }
-    }
-
-    if (!blk) {
+    auto fit = _free_by_size.lower_bound(make_pair(n, (unsigned char *)NULL));
+    if (fit == _free_by_size.end()) {
         // Couldn't find space in existing memory pool.
         // Try to allocate more memory.
         //
         if (!BlkMemMgr::_Reinit(n)) return (NULL);
 
-        return (Alloc(n, fill));
+        fit = _free_by_size.lower_bound(make_pair(n, (unsigned char *)NULL));
+        if (fit == _free_by_size.end()) return (NULL);
     }
 
-    if (fill) {
-        unsigned char *ptr = (unsigned char *)blk;
-        for (size_t i = 0; i < n * _blk_size; i++) ptr[i] = 0;
-    }
+    unsigned char *blk = fit->second;
+    auto           itr = _free_by_addr.find(blk);
+    _mem_run_t     run = itr->second;
+    _erase_free(itr);
+
+    //
+    // If run is strictly larger than request split it
+    //
+    if (n < run._nblks) _insert_free(blk + (_blk_size * n), {run._nblks - n, run._region});
+
+    _used[blk] = {n, run._region};
+
+    guard.unlock();
+
+    if (fill) memset(blk, 0, n * _blk_size);
 
     return (blk);
 }
@@ -228,35 +239,64 @@ void BlkMemMgr::FreeMem(void *ptr)
 {
     SetDiagMsg("BlkMemMgr::FreeMem()");
 
-    bool found = false;
-    for (int r = 0; r < _mem_regions.size() && !found; r++) {
-        vector<_mem_allocation_t> &mem_region = _mem_regions[r];
-        for (int i = 0; i < mem_region.size() && !found; i++) {
-            if (ptr == mem_region[i]._blk) {
-                found = true;
-                mem_region[i]._nfree = mem_region[i]._nused;
-                mem_region[i]._nused = 0;
-            }
-        }
+    std::unique_lock<std::mutex> guard(_mutex);
+
+    auto used = _used.find(ptr);
+    if (used == _used.end()) {
+        cerr << "Failed to free block " << ptr << endl;
+        return;
     }
-    if (!found) cerr << "Failed to free block " << ptr << endl;
+
+    unsigned char *blk = (unsigned char *)ptr;
+    _mem_run_t     run = used->second;
+    _used.erase(used);
 
     //
-    // Collapse any two adjacent runs of they're both free
+    // Collapse with the adjacent runs, within the same memory region,
+    // if they're free
     //
-    bool collapse;
-    do {
-        collapse = false;
-        for (int r = 0; r < _mem_regions.size(); r++) {
-            vector<_mem_allocation_t> &mem_region = _mem_regions[r];
-            for (int i = 0; i < mem_region.size() - 1; i++) {
-                if (mem_region[i]._nfree && mem_region[i + 1]._nfree) {
-                    mem_region[i]._nfree += mem_region[i + 1]._nfree;
-                    mem_region.erase(mem_region.begin() + i + 1);
-                    collapse = true;
-                    break;
-                }
-            }
+    auto next = _free_by_addr.find(blk + (_blk_size * run._nblks));
+    if (next != _free_by_addr.end() && next->second._region == run._region) {
+        run._nblks += next->second._nblks;
+        _erase_free(next);
+    }
+
+    auto prev = _free_by_addr.lower_bound(blk);
+    if (prev != _free_by_addr.begin()) {
+        --prev;
+        if (prev->second._region == run._region && prev->first + (_blk_size * prev->second._nblks) == blk) {
+            blk = prev->first;
+            run._nblks += prev->second._nblks;
+            _erase_free(prev);
         }
-    } while (collapse);
+    }
+
+    _insert_free(blk, run);
+}
+
+void BlkMemMgr::GetStats(stats_t &stats)
+{
+    std::unique_lock<std::mutex> guard(_mutex);
+
+    stats.poolBlks = 0;
+    for (auto size : _mem_region_sizes) stats.poolBlks += size;
+    stats.maxPoolBlks = _mem_size_max;
+
+    stats.usedBlks = 0;
+    for (const auto &itr : _used) stats.usedBlks += itr.second._nblks;
+    stats.numAllocs = _used.size();
+
+    stats.freeBlks = stats.poolBlks - stats.usedBlks;
+    stats.freeRuns = _free_by_addr.size();
+    stats.largestFreeRun = _free_by_size.empty() ? 0 : _free_by_size.rbegin()->first;
+}
+
+double BlkMemMgr::GetFragmentation()
+{
+    stats_t stats;
+    GetStats(stats);
+
+    if (!stats.freeBlks) return (0.0);
+
+    return (1.0 - ((double)stats.largestFreeRun / (double)stats.freeBlks));
 }
@@ -209,6 +209,14 @@ void CurvilinearGrid::GetUserCoordinates(const DimsType &indices, CoordType &coo
 }
 
 bool CurvilinearGrid::GetIndicesCell(const CoordType &coords, DimsType &indices) const
+{
+    // An out of range hint is ignored, forcing a quad tree search
+    //
+    DimsType noHint = {std::numeric_limits<size_t>::max(), std::numeric_limits<size_t>::max(), std::numeric_limits<size_t>::max()};
+    return (GetIndicesCell(coords, noHint, indices));
+}
+
+bool CurvilinearGrid::GetIndicesCell(const CoordType &coords, const DimsType &hintCell, DimsType &indices) const
 {
     // Clamp coordinates on periodic boundaries to grid extents
     //
@@ -221,7 +229,7 @@ bool CurvilinearGrid::GetIndicesCell(const CoordType &coords, DimsType &indices)
 
     double lambda[4], zwgt[2];
     size_t i, j, k;
-    bool   inside = _insideGrid(x, y, z, i, j, k, lambda, zwgt);
+    bool   inside = _insideGrid(x, y, z, i, j, k, lambda, zwgt, &hintCell);
 
     if (!inside) return (false);
 
@@ -434,6 +442,23 @@ float CurvilinearGrid::GetValueNearestNeighbor(const CoordType &coords) const
 
 namespace {
 
+// Reads node values of a 2D RegularGrid directly from its block storage.
+// Indices must be in range
+//
+struct nodeReader_t {
+    nodeReader_t(const RegularGrid &rg) : blks(rg.GetBlks())
+    {
+        Grid::CopyToArr3(rg.GetBlockSize(), bs);
+        Grid::CopyToArr3(rg.GetDimensionInBlks(), bdims);
+    }
+
+    float operator()(size_t i, size_t j) const { return (blks[(j / bs[1]) * bdims[0] + (i / bs[0])][(j % bs[1]) * bs[0] + (i % bs[0])]); }
+
+    DimsType                    bs = {1, 1, 1};
+    DimsType                    bdims = {1, 1, 1};
+    const std::vector<float *> &blks;
+};
+
 float interpolateQuad(const float values[4], const double lambda[4], float mv)
 {
     // Special handling for any missing values
@@ -483,6 +508,35 @@ float CurvilinearGrid::GetValueLinear(const CoordType &coords) const
     CoordType cCoords;
     ClampCoord(coords, cCoords);
 
+    return (_getValueLinear(cCoords, nullptr));
+}
+
+void CurvilinearGrid::GetValues(const double *xyz, size_t n, float *values) const
+{
+    if (GetInterpolationOrder() == 0 || !GetBlks().size()) {
+        Grid::GetValues(xyz, n, values);
+        return;
+    }
+
+    // The cell containing each point is the hint for the next, so
+    // coherent points are located by a short walk instead of a quad
+    // tree search
+    //
+    DimsType cell = {std::numeric_limits<size_t>::max(), std::numeric_limits<size_t>::max(), std::numeric_limits<size_t>::max()};
+    for (size_t p = 0; p < n; p++) {
+        CoordType cCoords;
+        ClampCoord({xyz[3 * p], xyz[3 * p + 1], xyz[3 * p + 2]}, cCoords);
+
+        values[p] = _getValueLinear(cCoords, &cell);
+    }
+}
+
+// Interpolate at the (already clamped) coordinates cCoords. If 'cell' is
+// not null it is used as the hint cell for the point location, and is
+// updated with the containing cell if the point is inside the grid
+//
+float CurvilinearGrid::_getValueLinear(const CoordType &cCoords, DimsType *cell) const
+{
     // Get Wachspress coordinates for horizontal weights, and
     // simple linear interpolation weights for vertical axis. _insideGrid
     // handlese case where grid is 2D. I.e. if 2d then zwgt[0] == 1 &&
@@ -493,12 +547,14 @@ float CurvilinearGrid::GetValueLinear(const CoordType &coords) const
     double x = cCoords[0];
     double y = cCoords[1];
     double z = GetGeometryDim() == 3 ? cCoords[2] : 0.0;
-    bool   inside = _insideGrid(x, y, z, i, j, k, lambda, zwgt);
+    bool   inside = _insideGrid(x, y, z, i, j, k, lambda, zwgt, cell);
 
     float mv = GetMissingValue();
 
     if (!inside) return (mv);
 
+    if (cell) *cell = {i, j, k};
+
     // Use Wachspress coordinates as weights to do linear interpolation
     // along XY plane
     //
@@ -666,34 +722,138 @@ bool CurvilinearGrid::_insideFace(const DimsType &face, double pt[2], double lam
     return ret;
 }
 
+// Walk from the cell 'start' towards the cell containing the point 'pt'.
+// At each step the point is tested against the four directed edges of the
+// current XY quad, and if it lies outside of any of them the walk moves
+// to the neighbor across the edge the point is furthest beyond. Returns
+// true, along with the face and the Wachspress coordinates of the point,
+// if the containing face is reached. Returns false if 'start' is out of
+// range, the walk leaves the grid, or it doesn't converge within a few
+// steps (e.g. the point is far away or the quads are badly distorted)
+//
+bool CurvilinearGrid::_walkToFace(const DimsType &start, double pt[2], double lambda[4], DimsType &face) const
+{
+    const int maxSteps = 8;
+
+    const DimsType &cdims = GetCellDimensions();
+    if (start[0] >= cdims[0] || start[1] >= cdims[1]) return (false);
+
+    nodeReader_t xr(_xrg);
+    nodeReader_t yr(_yrg);
+
+    size_t i = start[0];
+    size_t j = start[1];
+    for (int step = 0; step < maxSteps; step++) {
+        // Counter-clockwise in index space, as returned by GetCellNodes()
+        //
+        double verts2d[] = {xr(i, j), yr(i, j), xr(i + 1, j), yr(i + 1, j), xr(i + 1, j + 1), yr(i + 1, j + 1), xr(i, j + 1), yr(i, j + 1)};
+
+        // The quad may be clockwise in user space
+        //
+        double area = 0.0;
+        for (int e = 0; e < 4; e++) {
+            int f = (e + 1) % 4;
+            area += verts2d[2 * e] * verts2d[2 * f + 1] - verts2d[2 * f] * verts2d[2 * e + 1];
+        }
+        double orientation = area < 0.0 ? -1.0 : 1.0;
+
+        // Each step moves one cell along I or J, so give up as soon as the
+        // point is clearly further away than the remaining steps could
+        // reach, measured in sizes of the current quad
+        //
+        double cellsAway = 0.0;
+        for (int d = 0; d < 2; d++) {
+            double minq = std::min(std::min(verts2d[d], verts2d[2 + d]), std::min(verts2d[4 + d], verts2d[6 + d]));
+            double maxq = std::max(std::max(verts2d[d], verts2d[2 + d]), std::max(verts2d[4 + d], verts2d[6 + d]));
+            double outside = std::max(minq - pt[d], pt[d] - maxq);
+            if (outside > 0.0) cellsAway += outside / (maxq - minq);
+        }
+        if (cellsAway > maxSteps - step) return (false);
+
+        int    exitEdge = -1;
+        double minSide = 0.0;
+        for (int e = 0; e < 4; e++) {
+            int    f = (e + 1) % 4;
+            double side = ((verts2d[2 * f] - verts2d[2 * e]) * (pt[1] - verts2d[2 * e + 1]) - (verts2d[2 * f + 1] - verts2d[2 * e + 1]) * (pt[0] - verts2d[2 * e])) * orientation;
+            if (side < minSide) {
+                minSide = side;
+                exitEdge = e;
+            }
+        }
+
+        if (exitEdge < 0) {
+            if (!Grid::PointInsideBoundingRectangle(pt, verts2d, 4)) return (false);
+            if (!WachspressCoords2D(verts2d, pt, 4, lambda)) return (false);
+
+            face = {i, j, 0};
+            return (true);
+        }
+
+        // Edges are (i,j)-(i+1,j), (i+1,j)-(i+1,j+1), (i+1,j+1)-(i,j+1),
+        // and (i,j+1)-(i,j)
+        //
+        switch (exitEdge) {
+        case 0:
+            if (j == 0) return (false);
+            j--;
+            break;
+        case 1:
+            if (i + 1 >= cdims[0]) return (false);
+            i++;
+            break;
+        case 2:
+            if (j + 1 >= cdims[1]) return (false);
+            j++;
+            break;
+        default:
+            if (i == 0) return (false);
+            i--;
+            break;
+        }
+    }
+
+    return (false);
+}
+
 // Search for a point inside the grid. If the point is inside return true,
 // and provide the Wachspress weights/coordinates for the point within
 // the XY quadrilateral cell containing the point in XY, and the linear
 // interpolation weights/coordinates along Z. If the grid is 2D then
 // zwgt[0] == 1.0, and zwgt[1] == 0.0. If the point is outside of the
-// grid the values of 'lambda', and 'zwgt' are not defined
+// grid the values of 'lambda', and 'zwgt' are not defined. If 'hint' is
+// not null the search starts with a walk from the hint cell, and only
+// falls back to the quad tree if the walk fails
 //
-bool CurvilinearGrid::_insideGrid(double x, double y, double z, size_t &i, size_t &j, size_t &k, double lambda[4], double zwgt[2]) const
+bool CurvilinearGrid::_insideGrid(double x, double y, double z, size_t &i, size_t &j, size_t &k, double lambda[4], double zwgt[2], const DimsType *hint) const
 {
     for (int l = 0; l < 4; l++) lambda[l] = 0.0;
     for (int l = 0; l < 2; l++) zwgt[l] = 0.0;
     i = j = k = 0;
 
-    // Find the indices for the faces that might contain the point
-    //
-    vector<DimsType> face_indices;
-    _qtr->GetPayloadContained(x, y, face_indices);
-
-    bool             inside = false;
-    double           pt[] = {x, y};
-    vector<DimsType> nodes(8);
-    for (int ii = 0; ii < face_indices.size(); ii++) {
-        if (_insideFace(face_indices[ii], pt, lambda, nodes)) {
-            i = face_indices[ii][0];
-            j = face_indices[ii][1];
-
-            inside = true;
-            break;
+    bool     inside = false;
+    double   pt[] = {x, y};
+    DimsType face;
+    if (hint && _walkToFace(*hint, pt, lambda, face)) {
+        i = face[0];
+        j = face[1];
+        inside = true;
+    }
+
+    if (!inside) {
+        // Find the indices for the faces that might contain the point
+        //
+        vector<DimsType> face_indices;
+        _qtr->GetPayloadContained(x, y, face_indices);
+
+        vector<DimsType> nodes(8);
+        for (int ii = 0; ii < face_indices.size(); ii++) {
+            if (_insideFace(face_indices[ii], pt, lambda, nodes)) {
+                i = face_indices[ii][0];
+                j = face_indices[ii][1];
+
+                inside = true;
+                break;
+            }
         }
     }
 
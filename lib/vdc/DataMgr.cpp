@@ -4,10 +4,14 @@
 #include <cstring>
 #include "vapor/VAssert.h"
 #include <cfloat>
+#include <cmath>
 #include <vector>
 #include <map>
 #include <algorithm>
 #include <type_traits>
+#include <chrono>
+#include <atomic>
+#include <vapor/OpenMPSupport.h>
 #include <vapor/VDCNetCDF.h>
 #include <vapor/DCWRF.h>
 #include <vapor/DCCF.h>
@@ -22,7 +26,9 @@
 #endif
 #include <vapor/DCUGRID.h>
 #include <vapor/DataMgr.h>
+#include <vapor/DataMgrUtils.h>
 #include <vapor/GeoUtil.h>
+#include <vapor/FileUtils.h>
 #ifdef WIN32
     #include <float.h>
 #endif
@@ -421,8 +427,14 @@ template<class T> void copy_block(const T *src, T *dst, const DimsType &min, con
 
     size_t block_size = vproduct(bs);
 
-    for (long k = my_min[2], kk = 0; k <= (long)my_max[2] && k < (long)dims[2]; k++, kk++) {
-        if (k < 0) continue;
+    // Each plane of the source region maps to distinct destination voxels,
+    // so planes may be copied in parallel
+    //
+    long nk = (long)my_max[2] - (long)my_min[2] + 1;
+#pragma omp parallel for
+    for (long kk = 0; kk < nk; kk++) {
+        long k = (long)my_min[2] + kk;
+        if (k < 0 || k >= (long)dims[2]) continue;
 
         // Coordinates of destination block (block coordinates)
         //
@@ -437,7 +449,7 @@ template<class T> void copy_block(const T *src, T *dst, const DimsType &min, con
             size_t dst_j_b = j / bs[1];
             size_t dst_j = j % bs[1];
 
-            for (long i = my_min[0], ii = 0; i <= (long)max[0] && i < (long)dims[0]; i++, ii++) {
+            for (long i = my_min[0], ii = 0; i <= (long)my_max[0] && i < (long)dims[0]; i++, ii++) {
                 if (i < 0) continue;
 
                 size_t dst_i_b = i / bs[0];
@@ -455,17 +467,52 @@ template<class T> void copy_block(const T *src, T *dst, const DimsType &min, con
     }
 }
 
-bool is_blocked(const DimsType &bs)
+// Voxel coordinates of the block bcoord of a grid with dimensions dims
+// and block size bs, extended by a one voxel halo on its upper,
+// non-boundary faces. Every cell whose first node lies in the block
+// lies within the extended box
+//
+void blk_halo_to_vox(const DimsType &bs, const DimsType &dims, const DimsType &bcoord, DimsType &vmin, DimsType &vmax)
 {
-    return (!std::all_of(bs.cbegin(), bs.cend(), [](size_t i) { return i == 1; }));
+    for (int i = 0; i < bs.size(); i++) {
+        vmin[i] = bcoord[i] * bs[i];
+        vmax[i] = std::min(bcoord[i] * bs[i] + bs[i], dims[i] - 1);
+    }
 }
 
-// Is string a number?
+// Compute the range of the voxels of the blocked region blks within
+// the box min to max, specified relative to the first voxel of the
+// region. bdims is the number of blocks along each axis of the
+// region. Voxels equal to mv are ignored if has_missing is true. If
+// no voxels contribute range_min > range_max
 //
-bool is_int(std::string str)
+template<class T>
+void blocked_range(const T *blks, const DimsType &bs, const DimsType &bdims, const DimsType &min, const DimsType &max, bool has_missing, double mv, double &range_min, double &range_max)
+{
+    range_min = std::numeric_limits<double>::infinity();
+    range_max = -std::numeric_limits<double>::infinity();
+
+    size_t block_size = vproduct(bs);
+
+    for (size_t k = min[2]; k <= max[2]; k++) {
+        for (size_t j = min[1]; j <= max[1]; j++) {
+            for (size_t i = min[0]; i <= max[0]; i++) {
+                size_t block_offset = ((k / bs[2]) * bdims[0] * bdims[1] + (j / bs[1]) * bdims[0] + (i / bs[0])) * block_size;
+                size_t offset = (k % bs[2]) * bs[0] * bs[1] + (j % bs[1]) * bs[0] + (i % bs[0]);
+
+                double v = blks[block_offset + offset];
+                if (has_missing && v == mv) continue;
+
+                range_min = std::min(range_min, v);
+                range_max = std::max(range_max, v);
+            }
+        }
+    }
+}
+
+bool is_blocked(const DimsType &bs)
 {
-    if (!str.empty() && str[0] == '-') str.erase(0, 1);
-    return str.find_first_not_of("0123456789") == std::string::npos;
+    return (!std::all_of(bs.cbegin(), bs.cend(), [](size_t i) { return i == 1; }));
 }
 
 template<typename T, enable_if_t<std::is_floating_point<T>::value, int> = 0> void _sanitizeFloats(T *buffer, size_t n)
@@ -481,7 +528,79 @@ template<typename T, enable_if_t<std::is_integral<T>::value, int> = 0> void _san
 
 template<typename T> bool contains(const vector<T> &v, T element) { return (find(v.begin(), v.end(), element) != v.end()); }
 
+// Mix the hash value \p v into \p seed
+//
+inline void hash_combine(size_t &seed, size_t v) { seed ^= v + 0x9e3779b9 + (seed << 6) + (seed >> 2); }
+
+// Upper bound, in bytes, on the total size of the temporary buffers used
+// to read blocked variables from the file system
+//
+const size_t maxSlabBufferSize = 256 * 1024 * 1024;
+
+// Number of times the calling thread holds DataMgr::_readMutex. Reading
+// a derived variable re-enters the DataMgr with the mutex held, and
+// the re-entrant calls must not wait on other threads that need it
+//
+thread_local int readLockDepth = 0;
+
+// True on the DataMgr's own worker threads: those that service
+// Prefetch(), and those started by GetVariables() and SampleAtPoints().
+// Worker threads only use free cache capacity: evicting a region could
+// release the blocks of an unlocked grid still in use by the
+// application. Reads that fail for lack of capacity are retried by
+// the calling thread. The exception is the final step of a progressive
+// read, which has no calling thread to fall back on
+//
+thread_local bool backgroundThread = false;
+
+// Marks the current thread as a worker thread, or not, for its
+// lifetime. Threads started by std::async may be reused, so the mark is
+// removed again
+//
+class backgroundThread_t {
+public:
+    backgroundThread_t(bool background = true) : _prev(backgroundThread) { backgroundThread = background; }
+    ~backgroundThread_t() { backgroundThread = _prev; }
+
+private:
+    bool _prev;
+};
+
+// A unique_lock on DataMgr::_readMutex that maintains readLockDepth
+//
+class readLock_t {
+public:
+    readLock_t(std::recursive_mutex &m) : _guard(m) { readLockDepth++; }
+    readLock_t(std::recursive_mutex &m, std::defer_lock_t t) : _guard(m, t) {}
+    ~readLock_t() { unlock(); }
+
+    bool owns_lock() const { return (_guard.owns_lock()); }
+
+    void lock()
+    {
+        if (_guard.owns_lock()) return;
+        _guard.lock();
+        readLockDepth++;
+    }
+
+    void unlock()
+    {
+        if (!_guard.owns_lock()) return;
+        _guard.unlock();
+        readLockDepth--;
+    }
+
+private:
+    std::unique_lock<std::recursive_mutex> _guard;
+};
 
+// Sub-meshes of unstructured grids are cached as regions of a pseudo
+// variable, whose name starts with this prefix. They are not reported
+// in the cache statistics
+//
+const string subMeshPrefix = "__subMesh_";
+
+bool isSubMesh(const string &varname) { return (varname.compare(0, subMeshPrefix.size(), subMeshPrefix) == 0); }
 
 };    // namespace
 
@@ -502,6 +621,16 @@ DataMgr::DataMgr(string format, size_t mem_size, int nthreads)
     _PipeLines.clear();
 
     _regionsList.clear();
+    _lockedRegionsList.clear();
+    _regionsPriority.clear();
+    _evictionPolicy = GreedyDualSize;
+    _evictionAge = 0.0;
+    _spillSecondsPerByte = 0.0;
+    _spillWriteSecondsPerByte = 0.0;
+    _regionsIndex.clear();
+    _regionsBlksIndex.clear();
+    _regionsGroupIndex.clear();
+    _loadingRegions.clear();
 
     _varInfoCacheSize_T.Clear();
     _varInfoCacheDouble.Clear();
@@ -509,16 +638,22 @@ DataMgr::DataMgr(string format, size_t mem_size, int nthreads)
 
     _doTransformHorizontal = false;
     _doTransformVertical = false;
-    _openVarName.clear();
+    _openVarNames.clear();
     _proj4String.clear();
     _proj4StringDefault.clear();
     _bs = {64, 64, 64};
+
+    _prefetchActive = 0;
+    _prefetchShutdown = false;
+    _prefetchGeneration = 0;
 }
 
 DataMgr::~DataMgr()
 {
     SetDiagMsg("DataMgr::~DataMgr()");
 
+    _stopPrefetch();
+
     if (_dc) delete _dc;
     _dc = NULL;
 
@@ -617,6 +752,14 @@ int DataMgr::Initialize(const vector<string> &files, const std::vector<string> &
         return (-1);
     }
 
+    // Identify the data set, and the version of its files, in the
+    // keys of spilled regions
+    //
+    ostringstream fingerprint;
+    fingerprint << _format;
+    for (const auto &file : files) fingerprint << ":" << file << ":" << FileUtils::GetFileSize(file) << ":" << FileUtils::GetFileModifiedTime(file);
+    _fingerprint = std::to_string(std::hash<string>()(fingerprint.str()));
+
     // Use UDUnits for unit conversion
     //
     rc = _udunits.Initialize();
@@ -686,7 +829,10 @@ bool DataMgr::GetMesh(string meshname, DC::Mesh &m) const
     VAssert(_dc);
 
     bool ok = _dvm.GetMesh(meshname, m);
-    if (!ok) { ok = _dc->GetMesh(meshname, m); }
+    if (!ok) {
+        readLock_t readGuard(_readMutex);
+        ok = _dc->GetMesh(meshname, m);
+    }
 
     if (!ok) return (ok);
 
@@ -734,9 +880,16 @@ vector<string> DataMgr::GetDataVarNames(int ndim, VarType type) const
 {
     VAssert(_dc);
 
-    if (_dataVarNamesCache[std::make_pair(type, ndim)].size()) { return (_dataVarNamesCache[std::make_pair(type, ndim)]); }
+    {
+        std::lock_guard<std::mutex> guard(_dataVarNamesCacheMutex);
+        if (_dataVarNamesCache[std::make_pair(type, ndim)].size()) { return (_dataVarNamesCache[std::make_pair(type, ndim)]); }
+    }
 
-    vector<string> vars = _dc->GetDataVarNames(ndim);
+    vector<string> vars;
+    {
+        readLock_t readGuard(_readMutex);
+        vars = _dc->GetDataVarNames(ndim);
+    }
     vector<string> derived_vars = _getDataVarNamesDerived(ndim);
     vars.insert(vars.end(), derived_vars.begin(), derived_vars.end());
 
@@ -756,6 +909,7 @@ vector<string> DataMgr::GetDataVarNames(int ndim, VarType type) const
         validVars.push_back(vars[i]);
     }
 
+    std::lock_guard<std::mutex> guard(_dataVarNamesCacheMutex);
     _dataVarNamesCache[std::make_pair(type, ndim)] = validVars;
     return (validVars);
 }
@@ -764,7 +918,11 @@ vector<string> DataMgr::GetCoordVarNames() const
 {
     VAssert(_dc);
 
-    vector<string> vars = _dc->GetCoordVarNames();
+    vector<string> vars;
+    {
+        readLock_t readGuard(_readMutex);
+        vars = _dc->GetCoordVarNames();
+    }
     vector<string> derived_vars = _dvm.GetCoordVarNames();
     vars.insert(vars.end(), derived_vars.begin(), derived_vars.end());
 
@@ -781,6 +939,7 @@ string DataMgr::GetTimeCoordVarName() const
     vector<string> cvars = _dvm.GetTimeCoordVarNames();
     if (!cvars.empty()) return (cvars[0]);
 
+    readLock_t readGuard(_readMutex);
     cvars = _dc->GetTimeCoordVarNames();
     if (!cvars.empty()) return (cvars[0]);
 
@@ -837,7 +996,10 @@ bool DataMgr::GetDataVarInfo(string varname, VAPoR::DC::DataVar &var) const
     VAssert(_dc);
 
     bool ok = _dvm.GetDataVarInfo(varname, var);
-    if (!ok) { ok = _dc->GetDataVarInfo(varname, var); }
+    if (!ok) {
+        readLock_t readGuard(_readMutex);
+        ok = _dc->GetDataVarInfo(varname, var);
+    }
     if (!ok) return (ok);
 
     return (true);
@@ -848,7 +1010,10 @@ bool DataMgr::GetCoordVarInfo(string varname, VAPoR::DC::CoordVar &var) const
     VAssert(_dc);
 
     bool ok = _dvm.GetCoordVarInfo(varname, var);
-    if (!ok) { ok = _dc->GetCoordVarInfo(varname, var); }
+    if (!ok) {
+        readLock_t readGuard(_readMutex);
+        ok = _dc->GetCoordVarInfo(varname, var);
+    }
     return (ok);
 }
 
@@ -857,7 +1022,10 @@ bool DataMgr::GetBaseVarInfo(string varname, VAPoR::DC::BaseVar &var) const
     VAssert(_dc);
 
     bool ok = _dvm.GetBaseVarInfo(varname, var);
-    if (!ok) { ok = _dc->GetBaseVarInfo(varname, var); }
+    if (!ok) {
+        readLock_t readGuard(_readMutex);
+        ok = _dc->GetBaseVarInfo(varname, var);
+    }
     return (ok);
 }
 
@@ -935,6 +1103,7 @@ size_t DataMgr::GetNumRefLevels(string varname) const
     DerivedVar *dvar = _getDerivedVar(varname);
     if (dvar) { return (dvar->GetNumRefLevels()); }
 
+    readLock_t readGuard(_readMutex);
     return (_dc->GetNumRefLevels(varname));
 }
 
@@ -947,6 +1116,7 @@ vector<size_t> DataMgr::GetCRatios(string varname) const
     DerivedVar *dvar = _getDerivedVar(varname);
     if (dvar) { return (dvar->GetCRatios()); }
 
+    readLock_t readGuard(_readMutex);
     return (_dc->GetCRatios(varname));
 }
 
@@ -1285,8 +1455,15 @@ Grid *DataMgr::_getVariable(size_t ts, string varname, int level, int lod, DimsT
     //
     if (dataless) varnames[0].clear();
 
-    vector<float *> blkvec;
-    rc = DataMgr::_get_regions<float>(ts, varnames, level, lod, true, dimsvec, bsvec, bminvec, bmaxvec, blkvec);
+    // Structured grids may be constructed from any cached region that
+    // contains the ROI.
+    //
+    bool contain = _gridHelper.IsStructured(gridType);
+
+    vector<float *>  blkvec;
+    vector<DimsType> rbminvec;
+    vector<DimsType> rbmaxvec;
+    rc = DataMgr::_get_regions<float>(ts, varnames, level, lod, true, contain, dimsvec, bsvec, bminvec, bmaxvec, blkvec, rbminvec, rbmaxvec);
     if (rc < 0) return (NULL);
 
     // Get dimensions for connectivity variables (if any)
@@ -1297,14 +1474,12 @@ Grid *DataMgr::_getVariable(size_t ts, string varname, int level, int lod, DimsT
     vector<DimsType>       conn_bminvec;
     vector<DimsType>       conn_bmaxvec;
 
-    vector<int *> conn_blkvec;
-    if (_gridHelper.IsUnstructured(gridType)) {
-        rc = _setupConnVecs(ts, varname, level, lod, conn_varnames, conn_dimsvec, conn_bsvec, conn_bminvec, conn_bmaxvec);
-        if (rc < 0) return (NULL);
+    vector<int *>    conn_blkvec;
+    vector<DimsType> conn_rbminvec;
+    vector<DimsType> conn_rbmaxvec;
 
-        rc = DataMgr::_get_regions<int>(ts, conn_varnames, level, lod, true, conn_dimsvec, conn_bsvec, conn_bminvec, conn_bmaxvec, conn_blkvec);
-        if (rc < 0) return (NULL);
-    }
+    DimsType gmin, gmax;
+    map_blk_to_vox(bsvec[0], dimsvec[0], bminvec[0], bmaxvec[0], gmin, gmax);
 
     if (_gridHelper.IsUnstructured(gridType)) {
         DimsType                   vertexDims;
@@ -1318,10 +1493,48 @@ Grid *DataMgr::_getVariable(size_t ts, string varname, int level, int lod, DimsT
 
         _ugrid_setup(dvar, vertexDims, faceDims, edgeDims, location, maxVertexPerFace, maxFacePerVertex, vertexOffset, faceOffset, ts);
 
-        rg = _gridHelper.MakeGridUnstructured(gridType, ts, level, lod, dvar, cvarsinfo, roi_dims, dimsvec[0], blkvec, bsvec, bminvec, bmaxvec, conn_blkvec, conn_bsvec, conn_bminvec, conn_bmaxvec,
+        rc = _setupConnVecs(ts, varname, level, lod, conn_varnames, conn_dimsvec, conn_bsvec, conn_bminvec, conn_bmaxvec);
+        if (rc < 0) return (NULL);
+
+        // conn_ptrs are the connectivity arrays handed to the grid,
+        // conn_blkvec the cache regions that contain them
+        //
+        vector<int *> conn_ptrs;
+        if ((gmin[0] > 0 || gmax[0] < vertexDims[0] - 1) && _sub_mesh_supported(varname)) {
+            // Only a range of the nodes was requested. Construct the grid
+            // from the sub-mesh of faces whose nodes are all in range
+            //
+            int *blks = _get_sub_mesh(ts, varname, level, lod, conn_varnames, conn_dimsvec, conn_bsvec, conn_bminvec, conn_bmaxvec, bminvec[0][0], bmaxvec[0][0], gmin[0], gmax[0], faceDims,
+                                      maxVertexPerFace, maxFacePerVertex, vertexOffset, faceOffset);
+            if (!blks) return (NULL);
+            conn_blkvec.push_back(blks);
+
+            string node_face_var;
+            string dummy;
+            bool   ok = _getVarConnVars(varname, dummy, node_face_var, dummy, dummy, dummy, dummy);
+            VAssert(ok);
+
+            size_t nfaces = blks[0];
+            int *  ptr = blks + 1;
+            for (int i = 0; i < conn_varnames.size(); i++) {
+                conn_ptrs.push_back(ptr);
+                ptr += conn_varnames[i] == node_face_var ? (gmax[0] - gmin[0] + 1) * maxFacePerVertex : nfaces * maxVertexPerFace;
+            }
+
+            vertexDims[0] = gmax[0] - gmin[0] + 1;
+            faceDims[0] = nfaces;
+            vertexOffset = 0;
+            faceOffset = 0;
+        } else {
+            rc = DataMgr::_get_regions<int>(ts, conn_varnames, level, lod, true, false, conn_dimsvec, conn_bsvec, conn_bminvec, conn_bmaxvec, conn_blkvec, conn_rbminvec, conn_rbmaxvec);
+            if (rc < 0) return (NULL);
+            conn_ptrs = conn_blkvec;
+        }
+
+        rg = _gridHelper.MakeGridUnstructured(gridType, ts, level, lod, dvar, cvarsinfo, roi_dims, dimsvec[0], blkvec, bsvec, bminvec, bmaxvec, conn_ptrs, conn_bsvec, conn_bminvec, conn_bmaxvec,
                                               vertexDims, faceDims, edgeDims, location, maxVertexPerFace, maxFacePerVertex, vertexOffset, faceOffset);
     } else {
-        rg = _gridHelper.MakeGridStructured(gridType, ts, level, lod, dvar, cvarsinfo, roi_dims, dimsvec[0], blkvec, bsvec, bminvec, bmaxvec);
+        rg = _gridHelper.MakeGridStructured(gridType, ts, level, lod, dvar, cvarsinfo, roi_dims, dimsvec[0], blkvec, bsvec, bminvec, bmaxvec, rbminvec, rbmaxvec);
     }
     VAssert(rg);
 
@@ -1329,13 +1542,12 @@ Grid *DataMgr::_getVariable(size_t ts, string varname, int level, int lod, DimsT
     // Inform the grid of the offsets from the larger mesh to the
     // mesh subset contained in g. In general, gmin<=min
     //
-    DimsType gmin, gmax;
-    map_blk_to_vox(bsvec[0], dimsvec[0], bminvec[0], bmaxvec[0], gmin, gmax);
     rg->SetMinAbs(gmin);
 
     //
     // Safe to remove locks now that were not explicitly requested
     //
+    std::unique_lock<std::shared_mutex> guard(_regionsMutex);
     if (!lock) {
         for (int i = 0; i < blkvec.size(); i++) {
             if (blkvec[i]) _unlock_blocks(blkvec[i]);
@@ -1384,6 +1596,89 @@ Grid *DataMgr::GetVariable(size_t ts, string varname, int level, int lod, DimsTy
     return (rg);
 }
 
+template<typename T> int DataMgr::_getVariables(size_t ts, const vector<string> &varnames, int level, int lod, const T &min, const T &max, bool lock, vector<Grid *> &grids)
+{
+    grids.assign(varnames.size(), NULL);
+
+    // Request the variables concurrently. The first is requested on this
+    // thread, the remainder, if any, each on their own. Only cache hits
+    // and grid construction overlap: reads from the DC are serialized by
+    // _readMutex
+    //
+    vector<int> indices;
+    for (int i = 0; i < varnames.size(); i++) {
+        if (!varnames[i].empty()) indices.push_back(i);
+    }
+
+    // A thread reading a derived variable holds _readMutex, which the
+    // other threads would wait on, so it reads everything itself. So
+    // does a thread reading variables that may not be read elsewhere
+    //
+    size_t nconcurrent = readLockDepth > 0 || !_isThreadSafe(varnames) ? 1 : indices.size();
+
+    vector<std::future<Grid *>> reads;
+    for (int j = 1; j < nconcurrent; j++) {
+        reads.push_back(std::async(std::launch::async, [&, i = indices[j]] {
+            // Errors are reported by the calling thread
+            //
+            EnableErrMsg(false);
+            backgroundThread_t background;
+            return (GetVariable(ts, varnames[i], level, lod, min, max, true));
+        }));
+    }
+
+    bool failed = false;
+    if (!indices.empty()) {
+        grids[indices[0]] = GetVariable(ts, varnames[indices[0]], level, lod, min, max, true);
+        failed = !grids[indices[0]];
+    }
+    for (int j = 1; j < indices.size(); j++) {
+        int i = indices[j];
+        grids[i] = j < nconcurrent ? reads[j - 1].get() : NULL;
+
+        // Worker threads can't make room in the cache. Read anything
+        // they failed to read here
+        //
+        if (!grids[i] && !failed) grids[i] = GetVariable(ts, varnames[i], level, lod, min, max, true);
+        if (!grids[i] && !failed) {
+            SetErrMsg("Failed to read variable \"%s\" at time step (%d), and\n"
+                      "refinement level (%d) and level-of-detail (%d)",
+                      varnames[i].c_str(), ts, level, lod);
+        }
+        failed = failed || !grids[i];
+    }
+
+    // Either all of the grids are returned or none of them
+    //
+    if (!lock || failed) {
+        for (auto g : grids) {
+            if (g) UnlockGrid(g);
+        }
+    }
+    if (failed) {
+        for (auto &g : grids) {
+            if (g) delete g;
+            g = NULL;
+        }
+        return (-1);
+    }
+    return (0);
+}
+
+int DataMgr::GetVariables(size_t ts, const vector<string> &varnames, int level, int lod, CoordType min, CoordType max, bool lock, vector<Grid *> &grids)
+{
+    SetDiagMsg("DataMgr::GetVariables(%d, %s, %d, %d, %s, %s, %d)", ts, vector_to_string(varnames).c_str(), level, lod, vector_to_string(min).c_str(), vector_to_string(max).c_str(), lock);
+
+    return (_getVariables(ts, varnames, level, lod, min, max, lock, grids));
+}
+
+int DataMgr::GetVariables(size_t ts, const vector<string> &varnames, int level, int lod, DimsType min, DimsType max, bool lock, vector<Grid *> &grids)
+{
+    SetDiagMsg("DataMgr::GetVariables(%d, %s, %d, %d, %s, %s, %d)", ts, vector_to_string(varnames).c_str(), level, lod, vector_to_string(min).c_str(), vector_to_string(max).c_str(), lock);
+
+    return (_getVariables(ts, varnames, level, lod, min, max, lock, grids));
+}
+
 int DataMgr::GetVariableExtents(size_t ts, string varname, int level, int lod, CoordType &min, CoordType &max)
 {
     SetDiagMsg("DataMgr::GetVariableExtents(%d, %s, %d, %d)", ts, varname.c_str(), level, lod);
@@ -1462,17 +1757,26 @@ int DataMgr::GetDataRange(size_t ts, string varname, int level, int lod, CoordTy
 
     // See if we've already cache'd it.
     //
-    ostringstream oss;
-    oss << "VariableRange";
-    oss << vector_to_string(min_ui);
-    oss << vector_to_string(max_ui);
-    string key = oss.str();
+    const string key = "VariableRange";
 
-    if (_varInfoCacheDouble.Get(ts, varname, level, lod, key, range)) {
+    if (_varInfoCacheDouble.Get(ts, varname, level, lod, key, min_ui, max_ui, range)) {
         VAssert(range.size() == 2);
         return (0);
     }
 
+    // Use the per-block ranges recorded in the data collection, if
+    // any, to avoid reading and reconstructing the data. These are the
+    // ranges of the data as written, and coarser refinement levels and
+    // levels of detail may have values outside of them
+    //
+    rc = 0;
+    if (level == -1 && lod == -1) rc = _getDataRangesFromMetadata(ts, varname, level, lod, {min_ui}, {max_ui}, range);
+    if (rc < 0) return (-1);
+    if (rc > 0) {
+        _varInfoCacheDouble.Set(ts, varname, level, lod, key, min_ui, max_ui, range);
+        return (0);
+    }
+
     const Grid *sg = DataMgr::GetVariable(ts, varname, level, lod, min_ui, max_ui, false);
     if (!sg) return (-1);
 
@@ -1482,160 +1786,524 @@ int DataMgr::GetDataRange(size_t ts, string varname, int level, int lod, CoordTy
 
     delete sg;
 
-    _varInfoCacheDouble.Set(ts, varname, level, lod, key, range);
+    _varInfoCacheDouble.Set(ts, varname, level, lod, key, min_ui, max_ui, range);
 
     return (0);
 }
 
-int DataMgr::GetDimLensAtLevel(string varname, int level, std::vector<size_t> &dims_at_level, std::vector<size_t> &bs_at_level, long ts) const
+int DataMgr::SampleAtPoints(size_t ts, string varname, int level, int lod, const vector<CoordType> &points, float *values)
 {
-    VAssert(_dc);
-    dims_at_level.clear();
-    bs_at_level.clear();
+    SetDiagMsg("DataMgr::SampleAtPoints(%d,%s,%d)", ts, varname.c_str(), points.size());
 
-    int         rc = 0;
-    DerivedVar *dvar = _getDerivedVar(varname);
-    if (dvar) {
-        rc = dvar->GetDimLensAtLevel(level, dims_at_level, bs_at_level);
-    } else {
-        rc = _dc->GetDimLensAtLevel(varname, level, dims_at_level, bs_at_level, ts);
-    }
+    int rc = _level_correction(varname, level);
     if (rc < 0) return (-1);
 
+    rc = _lod_correction(varname, lod);
+    if (rc < 0) return (-1);
 
-    return (0);
+    int nthreads = _isThreadSafe({varname}) ? std::max(1, _nthreads) : 1;
+
+    return (_sampleAtPoints(ts, varname, level, lod, points, values, nthreads));
 }
 
-vector<string> DataMgr::_get_var_dependencies_1(string varname) const
+int DataMgr::GetTimeSeries(string varname, int level, int lod, const vector<CoordType> &points, size_t ts0, size_t ts1, vector<float> &values)
 {
-    vector<string> varnames;
-
-    DerivedVar *derivedVar = _getDerivedVar(varname);
-    if (derivedVar) { varnames = derivedVar->GetInputs(); }
+    SetDiagMsg("DataMgr::GetTimeSeries(%s,%d,%d,%d)", varname.c_str(), points.size(), ts0, ts1);
 
-    // No more dependencies if not a data variable
-    //
-    if (!_isDataVar(varname)) return (varnames);
+    values.clear();
 
-    vector<string> cvars;
-    bool           ok = GetVarCoordVars(varname, false, cvars);
-    if (ok) {
-        for (int i = 0; i < cvars.size(); i++) varnames.push_back(cvars[i]);
+    if (ts1 < ts0 || ts1 >= GetNumTimeSteps(varname)) {
+        SetErrMsg("Invalid time step range : %d %d", ts0, ts1);
+        return (-1);
     }
 
-    // Test for connectivity variables, if any
-    //
-    string face_node_var;
-    string node_face_var;
-    string face_edge_var;
-    string face_face_var;
-    string edge_node_var;
-    string edge_face_var;
-    ok = _getVarConnVars(varname, face_node_var, node_face_var, face_edge_var, face_face_var, edge_node_var, edge_face_var);
-    if (ok) {
-        if (!face_node_var.empty()) varnames.push_back(face_node_var);
-        if (!node_face_var.empty()) varnames.push_back(node_face_var);
-        if (!face_edge_var.empty()) varnames.push_back(face_edge_var);
-        if (!face_face_var.empty()) varnames.push_back(face_face_var);
-        if (!edge_node_var.empty()) varnames.push_back(edge_node_var);
-        if (!edge_face_var.empty()) varnames.push_back(edge_face_var);
-    }
+    int rc = _level_correction(varname, level);
+    if (rc < 0) return (-1);
 
-    sort(varnames.begin(), varnames.end());
-    varnames.erase(unique(varnames.begin(), varnames.end()), varnames.end());
-    return (varnames);
-}
+    rc = _lod_correction(varname, lod);
+    if (rc < 0) return (-1);
 
-vector<string> DataMgr::_get_var_dependencies_all(vector<string> varnames, vector<string> dependencies) const
-{
-    // Recursively look for all of a variable's dependencies, handing any
-    // cycles in the dependency graph
+    values.resize((ts1 - ts0 + 1) * points.size());
+
+    // Sample the time steps in turn on the calling thread: reads from
+    // the DC are serialized, so worker threads would gain little. The
+    // regions read, of the variable and of its coordinate variables,
+    // are evicted before the rest of the cache so that the interactive
+    // working set survives long series. Time steps that can't be sampled
+    // are left as gaps, marked by NaN
     //
-    vector<string> new_varnames;
-    for (int i = 0; i < varnames.size(); i++) {
-        vector<string> new_dependencies = _get_var_dependencies_1(varnames[i]);
+    const std::thread::id self = std::this_thread::get_id();
+    {
+        std::unique_lock<std::shared_mutex> guard(_regionsMutex);
+        _transientRegions[self].clear();
+    }
+
+    size_t nfailed = 0;
+    for (size_t ts = ts0; ts <= ts1; ts++) {
+        float *tsValues = values.data() + (ts - ts0) * points.size();
+        if (_sampleAtPoints(ts, varname, level, lod, points, tsValues, 1) < 0) {
+            std::fill(tsValues, tsValues + points.size(), std::nanf(""));
+            nfailed++;
+        }
 
-        for (int j = 0; j < new_dependencies.size(); j++) {
-            // Avoid cycles by not adding variable names that are already
-            // in the dependencies vector
-            //
-            if (!contains(dependencies, new_dependencies[j])) {
-                dependencies.push_back(new_dependencies[j]);
-                new_varnames.push_back(new_dependencies[j]);
-            }
+        vector<region_key_t> keys;
+        {
+            std::unique_lock<std::shared_mutex> guard(_regionsMutex);
+            keys.swap(_transientRegions[self]);
         }
+        for (const auto &key : keys) _demote_region(key);
     }
 
-    if (new_varnames.size()) { return (_get_var_dependencies_all(new_varnames, dependencies)); }
-    return (dependencies);
-}
-
-bool DataMgr::VariableExists(size_t ts, string varname, int level, int lod) const
-{
-    if (varname.empty()) return (false);
-
-    // disable error reporting
-    //
-    bool enabled = EnableErrMsg(false);
-    int  rc = _level_correction(varname, level);
-    if (rc < 0) {
-        EnableErrMsg(enabled);
-        return (false);
+    {
+        std::unique_lock<std::shared_mutex> guard(_regionsMutex);
+        _transientRegions.erase(self);
     }
 
-    rc = _lod_correction(varname, lod);
-    if (rc < 0) {
-        EnableErrMsg(enabled);
-        return (false);
+    if (nfailed == ts1 - ts0 + 1) {
+        SetErrMsg("Failed to sample variable/level/lod (%s, %d, %d) over time steps %d to %d", varname.c_str(), level, lod, ts0, ts1);
+        values.clear();
+        return (-1);
     }
-    EnableErrMsg(enabled);
 
-    string         key = "VariableExists";
-    vector<size_t> found;
-    if (_varInfoCacheSize_T.Get(ts, varname, level, lod, key, found)) { return (found[0]); }
+    return (0);
+}
 
+int DataMgr::_sampleAtPoints(size_t ts, string varname, int level, int lod, const vector<CoordType> &points, float *values, int nthreads)
+{
+    // Points outside of the variable's domain get the missing value of
+    // the variable's grids
     //
-    // Recursively find all variable dependencies needed by this
-    // varible. E.g. coordinate variables, input for derived variables,
-    // auxillary variables
-    //
-    vector<string> varnames = _get_var_dependencies_all(vector<string>({varname}), vector<string>());
-    varnames.insert(varnames.begin(), varname);
+    DC::DataVar dvar;
+    float       mv = std::numeric_limits<float>::infinity();
+    if (GetDataVarInfo(varname, dvar) && dvar.GetHasMissing()) mv = dvar.GetMissingValue();
 
-    // Now check for the existence of the variable and all of its
-    // dependencies, updating variable existence cache in process
+    DimsType bs = {1, 1, 1};
+    Grid::CopyToArr3(_bs.data(), GetNumDimensions(varname), bs);
+
+    // Group the points by the region of blocks, usually a single block,
+    // needed to interpolate them, so that each region is fetched, and
+    // its grid built, once. The grid of a group spans the union of the
+    // voxels its points need, which lies within the group's blocks
     //
-    for (int i = 0; i < varnames.size(); i++) {
-        if (_varInfoCacheSize_T.Get(ts, varnames[i], level, lod, key, found)) {
-            if (found[0])
-                continue;
-            else
-                return (false);
+    struct group_t {
+        DimsType       min_ui;
+        DimsType       max_ui;
+        vector<size_t> indices;
+    };
+    std::map<std::pair<DimsType, DimsType>, group_t> groups;
+    for (size_t i = 0; i < points.size(); i++) {
+        DimsType min_ui, max_ui;
+        int      rc = _find_bounding_grid(ts, varname, level, lod, points[i], points[i], min_ui, max_ui);
+        if (rc < 0) return (-1);
+
+        if (rc > 0) {
+            values[i] = mv;
+            continue;
         }
 
-        if (DataMgr::IsVariableNative(varnames[i])) {
-            bool exists = _dc->VariableExists(ts, varnames[i], level, lod);
-            if (!exists) {
-                _varInfoCacheSize_T.Set(ts, varnames[i], level, lod, key, vector<size_t>({0}));
-                return (false);
-            }
+        DimsType bmin, bmax;
+        map_vox_to_blk(bs, min_ui, bmin);
+        map_vox_to_blk(bs, max_ui, bmax);
+
+        auto itr = groups.find(std::make_pair(bmin, bmax));
+        if (itr == groups.end()) {
+            itr = groups.insert(std::make_pair(std::make_pair(bmin, bmax), group_t{min_ui, max_ui, {}})).first;
         } else {
-            DerivedVar *derivedVar = _getDerivedVar(varnames[i]);
-            if (!derivedVar) {
-                _varInfoCacheSize_T.Set(ts, varnames[i], level, lod, key, vector<size_t>({0}));
-                return (false);
+            for (int d = 0; d < min_ui.size(); d++) {
+                itr->second.min_ui[d] = std::min(itr->second.min_ui[d], min_ui[d]);
+                itr->second.max_ui[d] = std::max(itr->second.max_ui[d], max_ui[d]);
             }
         }
+        itr->second.indices.push_back(i);
     }
 
-    // Cache found results for later.
+    vector<const std::pair<const std::pair<DimsType, DimsType>, group_t> *> work;
+    for (const auto &group : groups) work.push_back(&group);
+
+    // Fetch the regions, and sample them, concurrently. Each thread
+    // takes the next unprocessed region until none are left. Regions
+    // that the worker threads fail to fetch are retried by the calling
+    // thread, which may evict regions to make room
     //
-    for (int i = 0; i < varnames.size(); i++) { _varInfoCacheSize_T.Set(ts, varnames[i], level, lod, key, vector<size_t>({1})); }
-    return (true);
-}
+    std::atomic<size_t> next(0);
+    std::atomic<bool>   failed(false);
+    vector<size_t>      retries;
+    std::mutex          retriesMutex;
+    auto                sampleGroup = [&](size_t g) {
+        const group_t &group = work[g]->second;
+
+        Grid *grid = GetVariable(ts, varname, level, lod, group.min_ui, group.max_ui, false);
+        if (!grid) return (false);
+
+        for (size_t i : group.indices) values[i] = grid->GetValue(points[i]);
+        delete grid;
+        return (true);
+    };
+    auto sample = [&] {
+        for (size_t g = next++; g < work.size() && !failed; g = next++) {
+            if (sampleGroup(g)) continue;
+
+            if (!backgroundThread) {
+                failed = true;
+                break;
+            }
+            std::unique_lock<std::mutex> guard(retriesMutex);
+            retries.push_back(g);
+        }
+    };
 
-bool DataMgr::IsVariableNative(string name) const
-{
+    vector<std::future<void>> workers;
+    for (size_t t = 1; t < std::min((size_t)nthreads, work.size()); t++) {
+        workers.push_back(std::async(std::launch::async, [&sample] {
+            // Errors are reported by the calling thread
+            //
+            EnableErrMsg(false);
+            backgroundThread_t background;
+            sample();
+        }));
+    }
+    sample();
+    for (auto &w : workers) w.get();
+
+    for (size_t i = 0; i < retries.size() && !failed; i++) {
+        if (!sampleGroup(retries[i])) failed = true;
+    }
+
+    if (failed) {
+        SetErrMsg("Failed to sample variable/timestep/level/lod (%s, %d, %d, %d)", varname.c_str(), ts, level, lod);
+        return (-1);
+    }
+
+    return (0);
+}
+
+int DataMgr::_getDataRangesFromMetadata(size_t ts, string varname, int level, int lod, const vector<DimsType> &mins, const vector<DimsType> &maxs, vector<double> &ranges)
+{
+    VAssert(mins.size() == maxs.size());
+    ranges.clear();
+
+    // Derived variables have no stored metadata, and the stored block
+    // ranges of variables with missing values may include them
+    //
+    if (_getDerivedVar(varname)) return (0);
+
+    DC::DataVar dvar;
+    if (!GetDataVarInfo(varname, dvar)) return (0);
+    if (dvar.GetHasMissing() || !dvar.GetMaskvar().empty()) return (0);
+
+    size_t ndims = GetNumDimensions(varname);
+
+    readLock_t readGuard(_readMutex);
+
+    int fd = _openVariableRead(ts, varname, level, lod);
+    if (fd < 0) return (-1);
+
+    int rc = 1;
+    for (size_t i = 0; i < mins.size() && rc > 0; i++) {
+        vector<size_t> minv, maxv;
+        Grid::CopyFromArr3(mins[i], minv);
+        minv.resize(ndims);
+        Grid::CopyFromArr3(maxs[i], maxv);
+        maxv.resize(ndims);
+
+        vector<double> range;
+        rc = _dc->ReadRegionRange(fd, minv, maxv, range);
+
+        // Fall back to reading the data if the recorded range is unusable
+        //
+        if (rc > 0 && (range.size() != 2 || !std::isfinite(range[0]) || !std::isfinite(range[1]))) rc = 0;
+        if (rc > 0) ranges.insert(ranges.end(), range.begin(), range.end());
+    }
+
+    (void)_closeVariable(fd);
+
+    if (rc <= 0) ranges.clear();
+    return (rc < 0 ? -1 : rc);
+}
+
+int DataMgr::GetBlocksInValueRange(size_t ts, string varname, int level, int lod, double vmin, double vmax, DimsType &bs, vector<DimsType> &blocks)
+{
+    SetDiagMsg("DataMgr::GetBlocksInValueRange(%d,%s)", ts, varname.c_str());
+
+    bs = {1, 1, 1};
+    blocks.clear();
+
+    int rc = _level_correction(varname, level);
+    if (rc < 0) return (-1);
+
+    rc = _lod_correction(varname, lod);
+    if (rc < 0) return (-1);
+
+    vector<size_t> dimsv;
+    rc = GetDimLensAtLevel(varname, level, dimsv, ts);
+    if (rc < 0) return (-1);
+
+    DimsType dims = {1, 1, 1};
+    Grid::CopyToArr3(dimsv, dims);
+    Grid::CopyToArr3(_bs.data(), dimsv.size(), bs);
+
+    DimsType bdims;
+    for (int i = 0; i < bdims.size(); i++) bdims[i] = ((dims[i] - 1) / bs[i]) + 1;
+    size_t nblocks = vproduct(bdims);
+
+    // Regions of variables that are not time varying are cached, and
+    // their ranges recorded, under time step 0
+    //
+    size_t       region_ts = IsTimeVarying(varname) ? ts : 0;
+    region_key_t hash = _make_region_key(region_ts, varname, level, lod, {0, 0, 0}, {0, 0, 0});
+
+    // Find the blocks whose ranges are not yet known
+    //
+    vector<DimsType> unknown;
+    {
+        std::unique_lock<std::mutex> guard(_blkRangesCacheMutex);
+
+        auto itr = _blkRangesCache.find(hash);
+        if (itr == _blkRangesCache.end()) {
+            blkRanges_t entry;
+            entry.varname = varname;
+            entry.bdims = bdims;
+            entry.mins.resize(nblocks);
+            entry.maxs.resize(nblocks);
+            entry.known.resize(nblocks, false);
+            itr = _blkRangesCache.insert(std::make_pair(hash, entry)).first;
+        }
+
+        for (size_t offset = 0; offset < nblocks; offset++) {
+            if (itr->second.known[offset]) continue;
+
+            DimsType bcoord = {0, 0, 0};
+            Wasp::VectorizeCoords(offset, bdims.data(), bcoord.data(), bdims.size());
+            unknown.push_back(bcoord);
+        }
+    }
+
+    // Try to fill in the unknown blocks from the DC's metadata. These
+    // are the ranges of the data as written, which coarser refinement
+    // levels and levels of detail may exceed, so they are only used at
+    // the finest
+    //
+    if (!unknown.empty()) {
+        vector<DimsType> mins(unknown.size()), maxs(unknown.size());
+        for (size_t i = 0; i < unknown.size(); i++) blk_halo_to_vox(bs, dims, unknown[i], mins[i], maxs[i]);
+
+        vector<double> ranges;
+        rc = 0;
+        if (level == -1 && lod == -1) rc = _getDataRangesFromMetadata(ts, varname, level, lod, mins, maxs, ranges);
+        if (rc < 0) return (-1);
+
+        if (rc > 0) {
+            std::unique_lock<std::mutex> guard(_blkRangesCacheMutex);
+
+            auto itr = _blkRangesCache.find(hash);
+            for (size_t i = 0; itr != _blkRangesCache.end() && i < unknown.size(); i++) {
+                size_t offset = Wasp::LinearizeCoords(unknown[i].data(), bdims.data(), bdims.size());
+                itr->second.mins[offset] = ranges[2 * i];
+                itr->second.maxs[offset] = ranges[2 * i + 1];
+                itr->second.known[offset] = true;
+            }
+        } else {
+            // Otherwise use any of the variable's regions that are
+            // already cached. Regions read later are handled by
+            // _get_region_from_fs(). _update_blk_ranges() queries the
+            // DC, so _readMutex is taken first
+            //
+            readLock_t                          readGuard(_readMutex);
+            std::shared_lock<std::shared_mutex> guard(_regionsMutex);
+
+            auto group = _regionsGroupIndex.find(hash);
+            if (group != _regionsGroupIndex.end()) {
+                for (const auto &region : group->second) {
+                    if (region->loading) continue;
+                    _update_blk_ranges(region_ts, varname, level, lod, dims, bs, region->key.bmin, region->key.bmax, (const float *)region->blks);
+                }
+            }
+        }
+    }
+
+    // Blocks whose range is still unknown may contain values in the
+    // range. The entry may have been purged in the meantime
+    //
+    std::unique_lock<std::mutex> guard(_blkRangesCacheMutex);
+
+    auto               itr = _blkRangesCache.find(hash);
+    const blkRanges_t *entry = itr != _blkRangesCache.end() ? &itr->second : NULL;
+    for (size_t offset = 0; offset < nblocks; offset++) {
+        if (entry && entry->known[offset] && (entry->maxs[offset] < vmin || entry->mins[offset] > vmax)) continue;
+
+        DimsType bcoord = {0, 0, 0};
+        Wasp::VectorizeCoords(offset, bdims.data(), bcoord.data(), bdims.size());
+        blocks.push_back(bcoord);
+    }
+
+    return (0);
+}
+
+int DataMgr::GetDimLensAtLevel(string varname, int level, std::vector<size_t> &dims_at_level, std::vector<size_t> &bs_at_level, long ts) const
+{
+    VAssert(_dc);
+    dims_at_level.clear();
+    bs_at_level.clear();
+
+    int         rc = 0;
+    DerivedVar *dvar = _getDerivedVar(varname);
+    if (dvar) {
+        rc = dvar->GetDimLensAtLevel(level, dims_at_level, bs_at_level);
+    } else {
+        readLock_t readGuard(_readMutex);
+        rc = _dc->GetDimLensAtLevel(varname, level, dims_at_level, bs_at_level, ts);
+    }
+    if (rc < 0) return (-1);
+
+
+    return (0);
+}
+
+vector<string> DataMgr::_get_var_dependencies_1(string varname) const
+{
+    vector<string> varnames;
+
+    DerivedVar *derivedVar = _getDerivedVar(varname);
+    if (derivedVar) { varnames = derivedVar->GetInputs(); }
+
+    // No more dependencies if not a data variable
+    //
+    if (!_isDataVar(varname)) return (varnames);
+
+    vector<string> cvars;
+    bool           ok = GetVarCoordVars(varname, false, cvars);
+    if (ok) {
+        for (int i = 0; i < cvars.size(); i++) varnames.push_back(cvars[i]);
+    }
+
+    // Test for connectivity variables, if any
+    //
+    string face_node_var;
+    string node_face_var;
+    string face_edge_var;
+    string face_face_var;
+    string edge_node_var;
+    string edge_face_var;
+    ok = _getVarConnVars(varname, face_node_var, node_face_var, face_edge_var, face_face_var, edge_node_var, edge_face_var);
+    if (ok) {
+        if (!face_node_var.empty()) varnames.push_back(face_node_var);
+        if (!node_face_var.empty()) varnames.push_back(node_face_var);
+        if (!face_edge_var.empty()) varnames.push_back(face_edge_var);
+        if (!face_face_var.empty()) varnames.push_back(face_face_var);
+        if (!edge_node_var.empty()) varnames.push_back(edge_node_var);
+        if (!edge_face_var.empty()) varnames.push_back(edge_face_var);
+    }
+
+    sort(varnames.begin(), varnames.end());
+    varnames.erase(unique(varnames.begin(), varnames.end()), varnames.end());
+    return (varnames);
+}
+
+vector<string> DataMgr::_get_var_dependencies_all(vector<string> varnames, vector<string> dependencies) const
+{
+    // Recursively look for all of a variable's dependencies, handing any
+    // cycles in the dependency graph
+    //
+    vector<string> new_varnames;
+    for (int i = 0; i < varnames.size(); i++) {
+        vector<string> new_dependencies = _get_var_dependencies_1(varnames[i]);
+
+        for (int j = 0; j < new_dependencies.size(); j++) {
+            // Avoid cycles by not adding variable names that are already
+            // in the dependencies vector
+            //
+            if (!contains(dependencies, new_dependencies[j])) {
+                dependencies.push_back(new_dependencies[j]);
+                new_varnames.push_back(new_dependencies[j]);
+            }
+        }
+    }
+
+    if (new_varnames.size()) { return (_get_var_dependencies_all(new_varnames, dependencies)); }
+    return (dependencies);
+}
+
+bool DataMgr::_isThreadSafe(const vector<string> &varnames) const
+{
+    vector<string> names;
+    for (const auto &varname : varnames) {
+        if (!varname.empty()) names.push_back(varname);
+    }
+
+    for (const auto &varname : _get_var_dependencies_all(names, names)) {
+        DerivedVar *derivedVar = _getDerivedVar(varname);
+        if (derivedVar && !derivedVar->IsThreadSafe()) return (false);
+    }
+    return (true);
+}
+
+bool DataMgr::VariableExists(size_t ts, string varname, int level, int lod) const
+{
+    if (varname.empty()) return (false);
+
+    // disable error reporting
+    //
+    bool enabled = EnableErrMsg(false);
+    int  rc = _level_correction(varname, level);
+    if (rc < 0) {
+        EnableErrMsg(enabled);
+        return (false);
+    }
+
+    rc = _lod_correction(varname, lod);
+    if (rc < 0) {
+        EnableErrMsg(enabled);
+        return (false);
+    }
+    EnableErrMsg(enabled);
+
+    string         key = "VariableExists";
+    vector<size_t> found;
+    if (_varInfoCacheSize_T.Get(ts, varname, level, lod, key, found)) { return (found[0]); }
+
+    //
+    // Recursively find all variable dependencies needed by this
+    // varible. E.g. coordinate variables, input for derived variables,
+    // auxillary variables
+    //
+    vector<string> varnames = _get_var_dependencies_all(vector<string>({varname}), vector<string>());
+    varnames.insert(varnames.begin(), varname);
+
+    // Now check for the existence of the variable and all of its
+    // dependencies, updating variable existence cache in process
+    //
+    for (int i = 0; i < varnames.size(); i++) {
+        if (_varInfoCacheSize_T.Get(ts, varnames[i], level, lod, key, found)) {
+            if (found[0])
+                continue;
+            else
+                return (false);
+        }
+
+        if (DataMgr::IsVariableNative(varnames[i])) {
+            readLock_t readGuard(_readMutex);
+            bool       exists = _dc->VariableExists(ts, varnames[i], level, lod);
+            if (!exists) {
+                _varInfoCacheSize_T.Set(ts, varnames[i], level, lod, key, vector<size_t>({0}));
+                return (false);
+            }
+        } else {
+            DerivedVar *derivedVar = _getDerivedVar(varnames[i]);
+            if (!derivedVar) {
+                _varInfoCacheSize_T.Set(ts, varnames[i], level, lod, key, vector<size_t>({0}));
+                return (false);
+            }
+        }
+    }
+
+    // Cache found results for later.
+    //
+    for (int i = 0; i < varnames.size(); i++) { _varInfoCacheSize_T.Set(ts, varnames[i], level, lod, key, vector<size_t>({1})); }
+    return (true);
+}
+
+bool DataMgr::IsVariableNative(string name) const
+{
     vector<string> svec = _get_native_variables();
 
     for (int i = 0; i < svec.size(); i++) {
@@ -1659,10 +2327,12 @@ int DataMgr::AddDerivedVar(DerivedDataVar *derivedVar)
     //
     // Clear variable name cache
     //
+    std::unique_lock<std::mutex> guard(_dataVarNamesCacheMutex);
     for (auto itr = _dataVarNamesCache.begin(); itr != _dataVarNamesCache.end(); ++itr) {
         vector<string> &ref = itr->second;
         ref.clear();
     }
+    guard.unlock();
 
     _varInfoCacheSize_T.Purge(vector<string>({varname}));
 
@@ -1673,6 +2343,11 @@ void DataMgr::RemoveDerivedVar(string varname)
 {
     if (!_dvm.HasVar(varname)) return;
 
+    // The prefetch threads may be reading the variable
+    //
+    CancelPrefetch();
+    _waitPrefetchIdle();
+
     _dvm.RemoveVar(_dvm.GetVar(varname));
 
     _free_var(varname);
@@ -1680,31 +2355,56 @@ void DataMgr::RemoveDerivedVar(string varname)
     //
     // Clear variable name cache
     //
+    std::unique_lock<std::mutex> guard(_dataVarNamesCacheMutex);
     for (auto itr = _dataVarNamesCache.begin(); itr != _dataVarNamesCache.end(); ++itr) {
         vector<string> &ref = itr->second;
         ref.clear();
     }
+    guard.unlock();
 
     _varInfoCacheSize_T.Purge(vector<string>({varname}));
 }
 
 void DataMgr::Clear()
 {
+    // All regions are freed below, including any still being filled by
+    // the prefetch threads
+    //
+    CancelPrefetch();
+    _waitPrefetchIdle();
+
     _PipeLines.clear();
 
-    list<region_t>::iterator itr;
-    for (itr = _regionsList.begin(); itr != _regionsList.end(); itr++) {
-        const region_t &region = *itr;
+    std::unique_lock<std::mutex>        spillGuard(_spillMutex);
+    std::unique_lock<std::shared_mutex> guard(_regionsMutex);
 
-        if (region.blks) _blk_mem_mgr->FreeMem(region.blks);
+    for (auto list : {&_regionsList, &_lockedRegionsList}) {
+        for (const auto &region : *list) {
+            if (region.blks) _blk_mem_mgr->FreeMem(region.blks);
+        }
+        list->clear();
     }
-    _regionsList.clear();
+    _regionsPriority.clear();
+    _evictionAge = 0.0;
+    _regionsIndex.clear();
+    _regionsBlksIndex.clear();
+    _regionsGroupIndex.clear();
+
+    _pendingSpills.clear();
+    _spillCache.Clear();
+    guard.unlock();
+    spillGuard.unlock();
+
+    std::unique_lock<std::mutex> blkRangesGuard(_blkRangesCacheMutex);
+    _blkRangesCache.clear();
 }
 
 void DataMgr::UnlockGrid(const Grid *rg)
 {
     SetDiagMsg("DataMgr::UnlockGrid()");
 
+    std::unique_lock<std::shared_mutex> guard(_regionsMutex);
+
     const auto fb = _lockedFloatBlks.find(rg);
     if (fb != _lockedFloatBlks.end()) {
         auto &bvec = fb->second;
@@ -1720,6 +2420,355 @@ void DataMgr::UnlockGrid(const Grid *rg)
     }
 }
 
+int DataMgr::Prefetch(size_t ts, const vector<string> &varnames, int level, int lod, CoordType min, CoordType max)
+{
+    SetDiagMsg("DataMgr::Prefetch(%d, %s, %d, %d)", ts, vector_to_string(varnames).c_str(), level, lod);
+
+    if (!_dc) {
+        SetErrMsg("No data");
+        return (-1);
+    }
+
+    // Variables that may only be read on the calling thread are read
+    // when requested
+    //
+    vector<string> names;
+    for (const auto &varname : varnames) {
+        if (!varname.empty() && _isThreadSafe({varname})) names.push_back(varname);
+    }
+
+    std::unique_lock<std::mutex> guard(_prefetchMutex);
+
+    if (_prefetchThreads.empty()) {
+        int nthreads = std::max(1, std::min(_nthreads, 4));
+        for (int i = 0; i < nthreads; i++) { _prefetchThreads.push_back(std::thread(&DataMgr::_prefetchWorker, this)); }
+    }
+
+    for (const auto &varname : names) {
+        // Don't queue duplicate requests. E.g. successive animation frames
+        // prefetching overlapping windows of time steps
+        //
+        auto same = [&](const prefetch_t &p) { return (!p.refinement && p.ts == ts && p.varname == varname && p.level == level && p.lod == lod && p.min == min && p.max == max); };
+        if (std::find_if(_prefetchQueue.begin(), _prefetchQueue.end(), same) != _prefetchQueue.end()) continue;
+
+        prefetch_t p;
+        p.ts = ts;
+        p.varname = varname;
+        p.level = level;
+        p.lod = lod;
+        p.min = min;
+        p.max = max;
+        _prefetchQueue.push_back(p);
+    }
+    guard.unlock();
+
+    _prefetchCV.notify_all();
+    return (0);
+}
+
+Grid *DataMgr::GetVariableProgressive(size_t ts, string varname, int level, int lod, CoordType min, CoordType max, RefinementCallback callback)
+{
+    SetDiagMsg("DataMgr::GetVariableProgressive(%d, %s, %d, %d)", ts, varname.c_str(), level, lod);
+
+    int rc = _level_correction(varname, level);
+    if (rc < 0) return (NULL);
+
+    rc = _lod_correction(varname, lod);
+    if (rc < 0) return (NULL);
+
+    // Corrected values are negative, counting back from the finest
+    // resolution. Convert to non-negative values counting up from the
+    // coarsest
+    //
+    int maxLevel = DataMgr::GetNumRefLevels(varname) + level;
+    int maxLod = (int)DataMgr::GetCRatios(varname).size() + lod;
+
+    // Variables that may not be read by the background threads are read
+    // at the requested resolution right away
+    //
+    if (!_isThreadSafe({varname})) return (GetVariable(ts, varname, level, lod, min, max, true));
+
+    // Refinement steps increase the level and lod together until each
+    // reaches its maximum. Step 0, the coarsest, is read here. It, and
+    // each refinement, is locked: the refinements are read by other
+    // threads, which could otherwise evict the regions of the grids
+    // while the caller is using them
+    //
+    Grid *rg = GetVariable(ts, varname, 0, 0, min, max, true);
+    if (!rg) return (NULL);
+
+    int nsteps = std::max(maxLevel, maxLod) + 1;
+    if (nsteps < 2 || !callback) return (rg);
+
+    std::shared_ptr<refinement_t> refinement = std::make_shared<refinement_t>();
+    refinement->nsteps = nsteps;
+    refinement->callback = callback;
+
+    std::unique_lock<std::mutex> guard(_prefetchMutex);
+
+    if (_prefetchThreads.empty()) {
+        int nthreads = std::max(1, std::min(_nthreads, 4));
+        for (int i = 0; i < nthreads; i++) { _prefetchThreads.push_back(std::thread(&DataMgr::_prefetchWorker, this)); }
+    }
+
+    for (int step = 1; step < nsteps; step++) {
+        prefetch_t p;
+        p.ts = ts;
+        p.varname = varname;
+        p.level = std::min(step, maxLevel);
+        p.lod = std::min(step, maxLod);
+        p.min = min;
+        p.max = max;
+        p.step = step;
+        p.generation = _prefetchGeneration;
+        p.refinement = refinement;
+        _prefetchQueue.push_back(p);
+    }
+    guard.unlock();
+
+    _prefetchCV.notify_all();
+    return (rg);
+}
+
+void DataMgr::CancelPrefetch()
+{
+    // Reads in progress are left to complete. Waiting for them would
+    // stall the caller, typically the GUI thread, for the duration of
+    // a read. Refinements still in flight are discarded by _refine()
+    //
+    std::unique_lock<std::recursive_mutex> refineGuard(_refineMutex);
+    std::unique_lock<std::mutex>           guard(_prefetchMutex);
+    _prefetchQueue.clear();
+    _prefetchGeneration++;
+}
+
+void DataMgr::_prefetchWorker()
+{
+    // Failures are reported by the GetVariable() call that eventually
+    // requests the data, not by the prefetch. N.B. the setting is
+    // thread local
+    //
+    EnableErrMsg(false);
+    backgroundThread = true;
+
+    std::unique_lock<std::mutex> guard(_prefetchMutex);
+    for (;;) {
+        _prefetchCV.wait(guard, [this] { return (_prefetchShutdown || !_prefetchQueue.empty()); });
+        if (_prefetchShutdown) break;
+
+        prefetch_t p = _prefetchQueue.front();
+        _prefetchQueue.pop_front();
+        _prefetchActive++;
+        guard.unlock();
+
+        if (p.refinement) {
+            _refine(p);
+        } else if (VariableExists(p.ts, p.varname, p.level, p.lod)) {
+            Grid *g = GetVariable(p.ts, p.varname, p.level, p.lod, p.min, p.max, false);
+            if (g) delete g;
+        }
+
+        guard.lock();
+        _prefetchActive--;
+        if (_prefetchActive == 0) _prefetchIdleCV.notify_all();
+    }
+}
+
+void DataMgr::_waitPrefetchIdle()
+{
+    std::unique_lock<std::mutex> guard(_prefetchMutex);
+    _prefetchIdleCV.wait(guard, [this] { return (_prefetchActive == 0); });
+}
+
+DataMgr::PinSet::PinSet(DataMgr *dataMgr, const vector<string> &varnames, int level, int lod, CoordType min, CoordType max)
+: _dataMgr(dataMgr), _varnames(varnames), _level(level), _lod(lod), _min(min), _max(max)
+{
+    VAssert(_dataMgr);
+}
+
+DataMgr::PinSet::~PinSet() { Release(); }
+
+int DataMgr::PinSet::SetTimeWindow(size_t ts0, size_t ts1)
+{
+    // Release first so that the memory is available to the time steps
+    // entering the window
+    //
+    for (auto itr = _grids.begin(); itr != _grids.end();) {
+        auto next = std::next(itr);
+        if (itr->first < ts0 || itr->first > ts1) _release(itr->first);
+        itr = next;
+    }
+
+    int status = 0;
+    for (size_t ts = ts0; ts <= ts1; ts++) {
+        if (_grids.count(ts)) continue;
+
+        vector<Grid *> grids;
+        int            rc = _dataMgr->GetVariables(ts, _varnames, _level, _lod, _min, _max, true, grids);
+        if (rc < 0) {
+            status = -1;
+            continue;
+        }
+        _grids[ts] = grids;
+    }
+    return (status);
+}
+
+vector<Grid *> DataMgr::PinSet::GetGrids(size_t ts) const
+{
+    auto itr = _grids.find(ts);
+    if (itr == _grids.end()) return (vector<Grid *>());
+
+    return (itr->second);
+}
+
+void DataMgr::PinSet::Release()
+{
+    while (!_grids.empty()) _release(_grids.begin()->first);
+}
+
+void DataMgr::PinSet::_release(size_t ts)
+{
+    auto itr = _grids.find(ts);
+    if (itr == _grids.end()) return;
+
+    for (auto g : itr->second) {
+        _dataMgr->UnlockGrid(g);
+        delete g;
+    }
+    _grids.erase(itr);
+}
+
+void DataMgr::_refine(const prefetch_t &p)
+{
+    refinement_t &refinement = *p.refinement;
+
+    // Skip refinements already superseded by a finer one, or cancelled
+    //
+    {
+        std::unique_lock<std::recursive_mutex> guard(_refineMutex);
+        if (refinement.delivered >= p.step || p.generation != _prefetchGeneration) return;
+    }
+
+    // Intermediate steps only use free cache capacity, and are skipped
+    // if there is too little. The final step may evict unlocked regions,
+    // so that the requested resolution is delivered even when the
+    // cache is full
+    //
+    Grid *g;
+    {
+        backgroundThread_t background(p.step < refinement.nsteps - 1);
+        g = GetVariable(p.ts, p.varname, p.level, p.lod, p.min, p.max, true);
+    }
+    if (!g) return;
+
+    // Refinements may complete out of order when serviced by several
+    // threads. Only deliver grids finer than the last one delivered,
+    // and only if the request hasn't been cancelled in the meantime
+    //
+    std::unique_lock<std::recursive_mutex> guard(_refineMutex);
+    if (refinement.delivered >= p.step || p.generation != _prefetchGeneration) {
+        UnlockGrid(g);
+        delete g;
+        return;
+    }
+    refinement.delivered = p.step;
+    refinement.callback(g, p.level, p.lod);
+}
+
+void DataMgr::_stopPrefetch()
+{
+    {
+        std::unique_lock<std::mutex> guard(_prefetchMutex);
+        _prefetchQueue.clear();
+        _prefetchShutdown = true;
+    }
+    _prefetchCV.notify_all();
+
+    for (auto &t : _prefetchThreads) t.join();
+    _prefetchThreads.clear();
+}
+
+DataMgr::CacheStats &DataMgr::CacheStats::operator+=(const CacheStats &rhs)
+{
+    exactHits += rhs.exactHits;
+    containHits += rhs.containHits;
+    misses += rhs.misses;
+    evictions += rhs.evictions;
+    bytesEvicted += rhs.bytesEvicted;
+    bytesRead += rhs.bytesRead;
+    bytesDecompressed += rhs.bytesDecompressed;
+    readSeconds += rhs.readSeconds;
+    spillHits += rhs.spillHits;
+    bytesSpilled += rhs.bytesSpilled;
+    return (*this);
+}
+
+DataMgr::CacheStats DataMgr::GetCacheStats(string varname) const
+{
+    std::shared_lock<std::shared_mutex> guard(_regionsMutex);
+
+    CacheStats stats;
+    for (const auto &itr : _cacheStats) {
+        if (varname.empty() || itr.first == varname) stats += itr.second;
+    }
+    return (stats);
+}
+
+vector<string> DataMgr::GetCacheStatsVarNames() const
+{
+    std::shared_lock<std::shared_mutex> guard(_regionsMutex);
+
+    vector<string> varnames;
+    for (const auto &itr : _cacheStats) varnames.push_back(itr.first);
+    return (varnames);
+}
+
+void DataMgr::ResetCacheStats()
+{
+    std::unique_lock<std::shared_mutex> guard(_regionsMutex);
+    _cacheStats.clear();
+}
+
+string DataMgr::GetCacheStatsJSON() const
+{
+    auto toJSON = [](ostringstream &oss, const CacheStats &stats) {
+        oss << "{\"exactHits\": " << stats.exactHits << ", \"containHits\": " << stats.containHits << ", \"misses\": " << stats.misses << ", \"evictions\": " << stats.evictions
+            << ", \"bytesEvicted\": " << stats.bytesEvicted << ", \"bytesRead\": " << stats.bytesRead << ", \"bytesDecompressed\": " << stats.bytesDecompressed
+            << ", \"readSeconds\": " << stats.readSeconds << ", \"spillHits\": " << stats.spillHits << ", \"bytesSpilled\": " << stats.bytesSpilled << "}";
+    };
+
+    std::shared_lock<std::shared_mutex> guard(_regionsMutex);
+
+    size_t usedBytes = 0;
+    if (_blk_mem_mgr) {
+        BlkMemMgr::stats_t memStats;
+        BlkMemMgr::GetStats(memStats);
+        usedBytes = memStats.usedBlks * BlkMemMgr::GetBlkSize();
+    }
+
+    CacheStats total;
+    for (const auto &itr : _cacheStats) total += itr.second;
+
+    ostringstream oss;
+    oss << "{\"capacityBytes\": " << _mem_size * 1024 * 1024 << ", \"usedBytes\": " << usedBytes << ", \"spillBytes\": " << _spillCache.GetSize() << ", \"total\": ";
+    toJSON(oss, total);
+    oss << ", \"variables\": {";
+    for (auto itr = _cacheStats.begin(); itr != _cacheStats.end(); ++itr) {
+        if (itr != _cacheStats.begin()) oss << ", ";
+
+        oss << "\"";
+        for (char c : itr->first) {
+            if (c == '"' || c == '\\') oss << '\\';
+            oss << c;
+        }
+        oss << "\": ";
+        toJSON(oss, itr->second);
+    }
+    oss << "}}";
+    return (oss.str());
+}
+
 size_t DataMgr::GetNumDimensions(string varname) const
 {
     VAssert(_dc);
@@ -1768,33 +2817,88 @@ size_t DataMgr::GetVarGeometryDim(string varname) const
     return (mesh.GetGeometryDim());
 }
 
-template<typename T> T *DataMgr::_get_region_from_cache(size_t ts, string varname, int level, int lod, const DimsType &bmin, const DimsType &bmax, bool lock)
+template<typename T>
+T *DataMgr::_get_region_from_cache(size_t ts, string varname, int level, int lod, const DimsType &bmin, const DimsType &bmax, bool lock, bool contain, DimsType &rbmin, DimsType &rbmax)
 {
-    list<region_t>::iterator itr;
-    for (itr = _regionsList.begin(); itr != _regionsList.end(); itr++) {
-        region_t &region = *itr;
+    region_key_t key = _make_region_key(ts, varname, level, lod, bmin, bmax);
 
-        if (region.ts == ts && region.varname.compare(varname) == 0 && region.level == level && region.lod == lod && region.bmin == bmin && region.bmax == bmax) {
-            // Increment the lock counter
-            region.lock_counter += lock ? 1 : 0;
+    // Regions still being read from the file system are not yet valid
+    //
+    region_itr_t itr;
+    auto         idx = _regionsIndex.find(key);
+    if (idx != _regionsIndex.end() && !idx->second->loading) {
+        itr = idx->second;
+    } else {
+        if (!contain) return (NULL);
 
-            // Move region to front of list
-            region_t tmp_region = region;
-            _regionsList.erase(itr);
-            _regionsList.push_back(tmp_region);
+        // No exact match. Look for the smallest cached region that
+        // contains the requested one
+        //
+        key.bmin = key.bmax = {0, 0, 0};
+        auto group = _regionsGroupIndex.find(key);
+        if (group == _regionsGroupIndex.end()) return (NULL);
+
+        size_t minsize = std::numeric_limits<size_t>::max();
+        bool   found = false;
+        for (const auto &candidate : group->second) {
+            if (candidate->loading) continue;
+
+            const DimsType &cbmin = candidate->key.bmin;
+            const DimsType &cbmax = candidate->key.bmax;
+
+            bool   contains = true;
+            size_t size = 1;
+            for (int i = 0; i < bmin.size(); i++) {
+                if (cbmin[i] > bmin[i] || cbmax[i] < bmax[i]) contains = false;
+                size *= cbmax[i] - cbmin[i] + 1;
+            }
+            if (contains && size < minsize) {
+                minsize = size;
+                itr = candidate;
+                found = true;
+            }
+        }
+        if (!found) return (NULL);
+    }
 
-            SetDiagMsg("DataMgr::_get_region_from_cache() - data in cache %xll\n", tmp_region.blks);
-            return ((T *)tmp_region.blks);
+    region_t &region = *itr;
+    rbmin = region.key.bmin;
+    rbmax = region.key.bmax;
+
+    if (!isSubMesh(varname)) {
+        CacheStats &stats = _cacheStats[varname];
+        if (rbmin == bmin && rbmax == bmax) {
+            stats.exactHits++;
+        } else {
+            stats.containHits++;
         }
     }
 
-    return (NULL);
+    if (lock) {
+        // Locked regions are not candidates for eviction
+        //
+        if (region.lock_counter == 0) {
+            _regionsPriority.erase(std::make_pair(region.priority, (const void *)region.blks));
+            _lockedRegionsList.splice(_lockedRegionsList.end(), _regionsList, itr);
+        }
+        region.lock_counter++;
+    } else if (region.lock_counter == 0) {
+        // Move region to back (most recently used end) of list
+        //
+        _regionsList.splice(_regionsList.end(), _regionsList, itr);
+        _set_evictable(itr);
+    }
+
+    SetDiagMsg("DataMgr::_get_region_from_cache() - data in cache %xll\n", region.blks);
+    return ((T *)region.blks);
 }
 
 template<typename T>
 int DataMgr::_get_unblocked_region_from_fs(size_t ts, string varname, int level, int lod, const DimsType &grid_dims, const DimsType &grid_bs, const DimsType &grid_min, const DimsType &grid_max,
-                                           T *blks)
+                                           T *blks, size_t &nbytes)
 {
+    nbytes = 0;
+
     int fd = _openVariableRead(ts, varname, level, lod);
     if (fd < 0) return (fd);
 
@@ -1837,6 +2941,7 @@ int DataMgr::_get_unblocked_region_from_fs(size_t ts, string varname, int level,
             delete[] buf;
             return (-1);
         }
+        nbytes += vproduct(box_dims(file_min, file_max)) * sizeof(T);
 
         downsample(buf, box_dims(file_min, file_max), region, box_dims(grid_min, grid_max));
 
@@ -1848,6 +2953,7 @@ int DataMgr::_get_unblocked_region_from_fs(size_t ts, string varname, int level,
             _closeVariable(fd);
             return (-1);
         }
+        nbytes += vproduct(box_dims(grid_min, grid_max)) * sizeof(T);
     }
 
     copy_block(region, blks, grid_min, grid_max, grid_bs, grid_min, grid_max);
@@ -1861,8 +2967,10 @@ int DataMgr::_get_unblocked_region_from_fs(size_t ts, string varname, int level,
 
 template<typename T>
 int DataMgr::_get_blocked_region_from_fs(size_t ts, string varname, int level, int lod, const DimsType &file_bs, const DimsType &file_dims, const DimsType &grid_dims, const DimsType &grid_bs,
-                                         const DimsType &grid_min, const DimsType &grid_max, T *blks)
+                                         const DimsType &grid_min, const DimsType &grid_max, T *blks, size_t &nbytes)
 {
+    nbytes = 0;
+
     // Map requested region voxel coordinates to disk block coordinates
     //
     DimsType file_bmin, file_bmax;
@@ -1872,98 +2980,300 @@ int DataMgr::_get_blocked_region_from_fs(size_t ts, string varname, int level, i
     int fd = _openVariableRead(ts, varname, level, lod);
     if (fd < 0) return (fd);
 
+    // For 3D data read groups of 2D block slabs at a time. This bounds
+    // the memory required for the temporary buffers, while giving the
+    // DC's (e.g. WASP's) decompression threads enough blocks per read to
+    // keep them busy.
+    //
     DimsType bmin = file_bmin;
     DimsType bmax = file_bmax;
-
-    // For 3D data read 2D slabs one at a time. This just reduces
-    // memory requirements for the temporary buffer we need
-    //
-    size_t nreads = 1;
-    if (bmax[2] > bmin[2]) {
-        nreads = bmax[2] - bmin[2] + 1;
-        bmax[2] = bmin[2];
-    }
+    bmax[2] = bmin[2];
 
     DimsType file_min, file_max;
     map_blk_to_vox(file_bs, bmin, bmax, file_min, file_max);
-    T *file_block = new T[vproduct(box_dims(file_min, file_max))];
+    size_t slab_size = vproduct(box_dims(file_min, file_max));
+
+    // Two buffers so that the copy of one group into the destination
+    // blocks overlaps the read of the next. The DC itself can only
+    // service one read at a time. A second buffer is only needed when
+    // there is more than one group, and the two share the size bound
+    //
+    size_t nslabs = file_bmax[2] - file_bmin[2] + 1;
+    size_t slabs_per_read = std::max((size_t)1, std::min(nslabs, maxSlabBufferSize / (slab_size * sizeof(T))));
+    if (slabs_per_read < nslabs) slabs_per_read = std::max((size_t)1, std::min(slabs_per_read, maxSlabBufferSize / (2 * slab_size * sizeof(T))));
+    size_t nbuffers = slabs_per_read < nslabs ? 2 : 1;
+
+    // The buffers are entirely overwritten by each read, so are left
+    // uninitialized
+    //
+    std::unique_ptr<T[]> file_blocks[2];
+    for (size_t i = 0; i < nbuffers; i++) file_blocks[i].reset(new T[slab_size * slabs_per_read]);
+    std::future<void> copying;
 
     size_t ndims = GetNumDimensions(varname);
 
-    for (size_t i = 0; i < nreads; i++) {
+    int rc = 0;
+    for (size_t i = 0, cur = 0; i < nslabs && rc >= 0; i += slabs_per_read, cur = (cur + 1) % nbuffers) {
+        bmin[2] = file_bmin[2] + i;
+        bmax[2] = std::min(bmin[2] + slabs_per_read - 1, file_bmax[2]);
         map_blk_to_vox(file_bs, file_dims, bmin, bmax, file_min, file_max);
 
-        int rc = _readRegion(fd, file_min, file_max, ndims, file_block);
-        if (rc < 0) {
-            delete[] file_block;
-            return (-1);
+        T *file_block = file_blocks[cur].get();
+        rc = _readRegion(fd, file_min, file_max, ndims, file_block);
+
+        if (copying.valid()) copying.wait();
+        if (rc < 0) break;
+        nbytes += vproduct(box_dims(file_min, file_max)) * sizeof(T);
+
+        copying = std::async(std::launch::async, [=] { copy_block(file_block, blks, file_min, file_max, grid_bs, grid_min, grid_max); });
+    }
+    if (copying.valid()) copying.wait();
+
+    (void)_closeVariable(fd);
+
+    return (rc < 0 ? -1 : 0);
+}
+
+template<typename T>
+T *DataMgr::_get_region_from_fs(size_t ts, string varname, int level, int lod, const DimsType &grid_dims, const DimsType &grid_bs, const DimsType &grid_bmin, const DimsType &grid_bmax, bool lock)
+{
+    // The region is locked, and marked as loading, while it is filled so
+    // that it is neither evicted nor handed out to other threads
+    //
+    T *    blks;
+    size_t blks_size;
+    string spill_key;
+    {
+        std::unique_lock<std::shared_mutex> guard(_regionsMutex);
+        blks = (T *)_alloc_region(ts, varname, level, lod, grid_bmin, grid_bmax, grid_bs, sizeof(T), true, false);
+        if (blks) {
+            _regionsBlksIndex[blks]->loading = true;
+            blks_size = _regionsBlksIndex[blks]->nbytes;
+            spill_key = _spill_key(*_regionsBlksIndex[blks]);
+        }
+    }
+    _flush_spills();
+    if (!blks) return (NULL);
+
+    // Regions previously evicted to the spill cache are copied back
+    // without involving the DC
+    //
+    auto start = std::chrono::steady_clock::now();
+    if (_spillCache.Get(spill_key, blks, blks_size)) {
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        _update_blk_ranges(ts, varname, level, lod, grid_dims, grid_bs, grid_bmin, grid_bmax, blks);
+
+        std::unique_lock<std::shared_mutex> guard(_regionsMutex);
+        _cacheStats[varname].spillHits++;
+
+        double secondsPerByte = seconds / (double)std::max(blks_size, (size_t)1);
+        _spillSecondsPerByte = _spillSecondsPerByte > 0.0 ? 0.5 * (_spillSecondsPerByte + secondsPerByte) : secondsPerByte;
+
+        _regionsBlksIndex[blks]->cost = seconds;
+        _regionsBlksIndex[blks]->loading = false;
+        if (!lock) _unlock_blocks(blks);
+        return (blks);
+    }
+
+    readLock_t readGuard(_readMutex);
+    start = std::chrono::steady_clock::now();
+
+    vector<size_t> file_dimsv, file_bsv;
+    int            rc = GetDimLensAtLevel(varname, level, file_dimsv, file_bsv, ts);
+    VAssert(rc >= 0);
+
+    DimsType file_dims = {1, 1, 1};
+    Grid::CopyToArr3(file_dimsv, file_dims);
+    DimsType file_bs = {1, 1, 1};
+    Grid::CopyToArr3(file_bsv, file_bs);
+
+    // Get voxel coordinates of requested region, clamped to grid
+    // boundaries.
+    //
+    DimsType grid_min, grid_max;
+    map_blk_to_vox(grid_bs, grid_dims, grid_bmin, grid_bmax, grid_min, grid_max);
+
+    int nlevels = DataMgr::GetNumRefLevels(varname);
+
+    // If data aren't blocked on disk or if the requested level is not
+    // available do a non-blocked read
+    //
+    size_t nbytes = 0;
+    if (!is_blocked(file_bs) || level < -nlevels) {
+        rc = _get_unblocked_region_from_fs(ts, varname, level, lod, grid_dims, grid_bs, grid_min, grid_max, blks, nbytes);
+    } else {
+        rc = _get_blocked_region_from_fs(ts, varname, level, lod, file_bs, file_dims, grid_dims, grid_bs, grid_min, grid_max, blks, nbytes);
+    }
+
+    // Estimate the amount of storage read from the compression ratio
+    //
+    vector<size_t> cratios = GetCRatios(varname);
+    size_t         cratio = 1;
+    if (!cratios.empty()) cratio = cratios[std::max(0, std::min(lod < 0 ? (int)cratios.size() + lod : lod, (int)cratios.size() - 1))];
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    readGuard.unlock();
+
+    if (rc >= 0) _update_blk_ranges(ts, varname, level, lod, grid_dims, grid_bs, grid_bmin, grid_bmax, blks);
+
+    std::unique_lock<std::shared_mutex> guard(_regionsMutex);
+
+    CacheStats &stats = _cacheStats[varname];
+    stats.misses++;
+    stats.bytesDecompressed += nbytes;
+    stats.bytesRead += nbytes / std::max(cratio, (size_t)1);
+    stats.readSeconds += seconds;
+    if (rc < 0) {
+        _free_region(ts, varname, level, lod, grid_bmin, grid_bmax, true);
+        return (NULL);
+    }
+
+    // The time taken to read the region is the cost of evicting it
+    //
+    _regionsBlksIndex[blks]->cost = seconds;
+    _regionsBlksIndex[blks]->loading = false;
+    if (!lock) _unlock_blocks(blks);
+
+    SetDiagMsg("DataMgr::GetGrid() - data read from fs\n");
+    return (blks);
+}
+
+template<typename T>
+void DataMgr::_update_blk_ranges(size_t ts, string varname, int level, int lod, const DimsType &grid_dims, const DimsType &grid_bs, const DimsType &grid_bmin, const DimsType &grid_bmax, const T *blks)
+{
+    DimsType bdims;
+    for (int i = 0; i < bdims.size(); i++) bdims[i] = ((grid_dims[i] - 1) / grid_bs[i]) + 1;
+
+    // Ranges are only maintained for variables that have been queried
+    // with GetBlocksInValueRange(). Find the blocks of the region whose
+    // ranges are still unknown
+    //
+    region_key_t     hash = _make_region_key(ts, varname, level, lod, {0, 0, 0}, {0, 0, 0});
+    vector<DimsType> unknown;
+    {
+        std::unique_lock<std::mutex> guard(_blkRangesCacheMutex);
+
+        auto itr = _blkRangesCache.find(hash);
+        if (itr == _blkRangesCache.end() || itr->second.bdims != bdims) return;
+
+        size_t nblocks = Wasp::LinearizeCoords(grid_bmax.data(), grid_bmin.data(), grid_bmax.data(), grid_bmax.size()) + 1;
+        for (size_t offset = 0; offset < nblocks; offset++) {
+            DimsType bcoord = {0, 0, 0};
+            Wasp::VectorizeCoords(offset, grid_bmin.data(), grid_bmax.data(), bcoord.data(), bcoord.size());
+            if (!itr->second.known[Wasp::LinearizeCoords(bcoord.data(), bdims.data(), bdims.size())]) unknown.push_back(bcoord);
         }
+    }
+    if (unknown.empty()) return;
+
+    DC::DataVar dvar;
+    if (!GetDataVarInfo(varname, dvar)) return;
+
+    // Voxel coordinates of the region
+    //
+    DimsType grid_min, grid_max;
+    map_blk_to_vox(grid_bs, grid_dims, grid_bmin, grid_bmax, grid_min, grid_max);
+
+    DimsType rbdims;
+    for (int i = 0; i < rbdims.size(); i++) rbdims[i] = grid_bmax[i] - grid_bmin[i] + 1;
 
-        copy_block(file_block, blks, file_min, file_max, grid_bs, grid_min, grid_max);
+    vector<DimsType> known;
+    vector<double>   ranges;
+    for (const auto &bcoord : unknown) {
+        DimsType vmin, vmax;
+        blk_halo_to_vox(grid_bs, grid_dims, bcoord, vmin, vmax);
 
-        // Increment along slowest axis (2)
-        // This is a no-op if less than 3 dimensions
+        // The halo of blocks on the upper faces of the region lies
+        // outside of it, unless the region is on the grid boundary
         //
-        IncrementCoords(file_bmin.data(), file_bmax.data(), bmin.data(), bmin.size(), 2);
-        IncrementCoords(file_bmin.data(), file_bmax.data(), bmax.data(), bmin.size(), 2);
+        bool inside = true;
+        for (int i = 0; i < vmax.size(); i++) {
+            if (vmax[i] > grid_max[i]) inside = false;
+            vmin[i] -= grid_min[i];
+            vmax[i] -= grid_min[i];
+        }
+        if (!inside) continue;
+
+        double range_min, range_max;
+        blocked_range(blks, grid_bs, rbdims, vmin, vmax, dvar.GetHasMissing(), dvar.GetMissingValue(), range_min, range_max);
+        known.push_back(bcoord);
+        ranges.push_back(range_min);
+        ranges.push_back(range_max);
     }
 
-    (void)_closeVariable(fd);
+    std::unique_lock<std::mutex> guard(_blkRangesCacheMutex);
 
-    if (file_block) delete[] file_block;
+    auto itr = _blkRangesCache.find(hash);
+    if (itr == _blkRangesCache.end() || itr->second.bdims != bdims) return;
 
-    return (0);
+    for (size_t i = 0; i < known.size(); i++) {
+        size_t offset = Wasp::LinearizeCoords(known[i].data(), bdims.data(), bdims.size());
+        itr->second.mins[offset] = ranges[2 * i];
+        itr->second.maxs[offset] = ranges[2 * i + 1];
+        itr->second.known[offset] = true;
+    }
 }
 
 template<typename T>
-T *DataMgr::_get_region_from_fs(size_t ts, string varname, int level, int lod, const DimsType &grid_dims, const DimsType &grid_bs, const DimsType &grid_bmin, const DimsType &grid_bmax, bool lock)
+T *DataMgr::_get_region(size_t ts, string varname, int level, int lod, int nlods, const DimsType &dims, const DimsType &bs, const DimsType &bmin, const DimsType &bmax, bool lock, bool contain,
+                        DimsType &rbmin, DimsType &rbmax)
 {
-    T *blks = (T *)_alloc_region(ts, varname, level, lod, grid_bmin, grid_bmax, grid_bs, sizeof(T), lock, false);
-    if (!blks) return (NULL);
-
-    vector<size_t> file_dimsv, file_bsv;
-    int            rc = GetDimLensAtLevel(varname, level, file_dimsv, file_bsv, ts);
-    VAssert(rc >= 0);
+    if (lod < -nlods) lod = -nlods;
 
-    DimsType file_dims = {1, 1, 1};
-    Grid::CopyToArr3(file_dimsv, file_dims);
-    DimsType file_bs = {1, 1, 1};
-    Grid::CopyToArr3(file_bsv, file_bs);
+    region_key_t key = _make_region_key(ts, varname, level, lod, bmin, bmax);
 
-    // Get voxel coordinates of requested region, clamped to grid
-    // boundaries.
+    // See if region, or if contain is true a region that contains it,
+    // is already in cache. If not, and no other thread is already reading
+    // it, read from the file system.
     //
-    DimsType grid_min, grid_max;
-    map_blk_to_vox(grid_bs, grid_dims, grid_bmin, grid_bmax, grid_min, grid_max);
+    T *                 blks = NULL;
+    std::promise<bool> loaded;
+    readLock_t         readGuard(_readMutex, std::defer_lock);
+    for (;;) {
+        std::shared_future<bool> latch;
+        {
+            std::unique_lock<std::shared_mutex> guard(_regionsMutex);
+
+            blks = _get_region_from_cache<T>(ts, varname, level, lod, bmin, bmax, lock, contain, rbmin, rbmax);
+            if (blks) return (blks);
+
+            auto itr = _loadingRegions.find(key);
+            if (itr != _loadingRegions.end()) {
+                latch = itr->second;
+            } else if (readGuard.owns_lock()) {
+                _loadingRegions[key] = loaded.get_future().share();
+                break;
+            }
+        }
 
-    int nlevels = DataMgr::GetNumRefLevels(varname);
+        // A thread waiting for a region may hold _readMutex, e.g. while
+        // reading the inputs of a derived variable. So the thread that
+        // reads a region takes the mutex before announcing the read, and
+        // holds it until the read is done, or the two could wait on
+        // each other
+        //
+        if (!latch.valid()) {
+            readGuard.lock();
+            continue;
+        }
+        readGuard.unlock();
 
-    // If data aren't blocked on disk or if the requested level is not
-    // available do a non-blocked read
-    //
-    if (!is_blocked(file_bs) || level < -nlevels) {
-        rc = _get_unblocked_region_from_fs(ts, varname, level, lod, grid_dims, grid_bs, grid_min, grid_max, blks);
-    } else {
-        rc = _get_blocked_region_from_fs(ts, varname, level, lod, file_bs, file_dims, grid_dims, grid_bs, grid_min, grid_max, blks);
-    }
-    if (rc < 0) {
-        _free_region(ts, varname, level, lod, grid_bmin, grid_bmax, true);
-        return (NULL);
+        // Wait for the thread reading the region. If it succeeded the
+        // region will be found in the cache on the next pass. If it
+        // failed, e.g. a prefetch that found no free capacity, this
+        // thread reads the region itself
+        //
+        (void)latch.get();
     }
 
-    SetDiagMsg("DataMgr::GetGrid() - data read from fs\n");
-    return (blks);
-}
+    blks = (T *)_get_region_from_fs<T>(ts, varname, level, lod, dims, bs, bmin, bmax, lock);
+    rbmin = bmin;
+    rbmax = bmax;
 
-template<typename T> T *DataMgr::_get_region(size_t ts, string varname, int level, int lod, int nlods, const DimsType &dims, const DimsType &bs, const DimsType &bmin, const DimsType &bmax, bool lock)
-{
-    if (lod < -nlods) lod = -nlods;
+    {
+        std::unique_lock<std::shared_mutex> guard(_regionsMutex);
+        _loadingRegions.erase(key);
+    }
+    loaded.set_value(blks != NULL);
 
-    // See if region is already in cache. If not, read from the
-    // file system.
-    //
-    T *blks = _get_region_from_cache<T>(ts, varname, level, lod, bmin, bmax, lock);
-    if (!blks) { blks = (T *)_get_region_from_fs<T>(ts, varname, level, lod, dims, bs, bmin, bmax, lock); }
     if (!blks) {
         SetErrMsg("Failed to read region from variable/timestep/level/lod (%s, %d, %d, %d)", varname.c_str(), ts, level, lod);
         return (NULL);
@@ -1972,48 +3282,71 @@ template<typename T> T *DataMgr::_get_region(size_t ts, string varname, int leve
 }
 
 template<typename T>
-int DataMgr::_get_regions(size_t ts, const vector<string> &varnames, int level, int lod, bool lock, const vector<DimsType> &dimsvec,
+int DataMgr::_get_regions(size_t ts, const vector<string> &varnames, int level, int lod, bool lock, bool contain, const vector<DimsType> &dimsvec,
                           const vector<DimsType> &bsvec,    // native coordinates
-                          const vector<DimsType> &bminvec, const vector<DimsType> &bmaxvec, vector<T *> &blkvec)
+                          const vector<DimsType> &bminvec, const vector<DimsType> &bmaxvec, vector<T *> &blkvec, vector<DimsType> &rbminvec, vector<DimsType> &rbmaxvec)
 {
-    blkvec.clear();
+    blkvec.assign(varnames.size(), NULL);
+    rbminvec = bminvec;
+    rbmaxvec = bmaxvec;
 
+    vector<size_t> tsvec(varnames.size(), ts);
+    vector<int>    nlodsvec(varnames.size(), 0);
     for (int i = 0; i < varnames.size(); i++) {
-        if (varnames[i].empty()) {    // nothing to do
-            blkvec.push_back(NULL);
-            continue;
-        }
+        if (varnames[i].empty()) continue;    // nothing to do
 
         DC::BaseVar var;
         int         rc = GetBaseVarInfo(varnames[i], var);
         if (rc < 0) return (rc);
 
-        int nlods = var.GetCRatios().size();
-
-        size_t my_ts = ts;
+        nlodsvec[i] = var.GetCRatios().size();
 
         // If variable isn't time varying time step should always be 0
         //
-        if (!DataMgr::IsTimeVarying(varnames[i])) my_ts = 0;
+        if (!DataMgr::IsTimeVarying(varnames[i])) tsvec[i] = 0;
+    }
 
-        T *blks = _get_region<T>(my_ts, varnames[i], level, lod, nlods, dimsvec[i], bsvec[i], bminvec[i], bmaxvec[i], true);
-        if (!blks) {
-            for (int i = 0; i < blkvec.size(); i++) {
-                if (blkvec[i]) _unlock_blocks(blkvec[i]);
-            }
-            return (-1);
+    // Satisfy as many of the requests as possible from the cache
+    //
+    vector<int> misses;
+    {
+        std::unique_lock<std::shared_mutex> guard(_regionsMutex);
+        for (int i = 0; i < varnames.size(); i++) {
+            if (varnames[i].empty()) continue;
+
+            int my_lod = std::max(lod, -nlodsvec[i]);
+            blkvec[i] = _get_region_from_cache<T>(tsvec[i], varnames[i], level, my_lod, bminvec[i], bmaxvec[i], true, contain, rbminvec[i], rbmaxvec[i]);
+            if (!blkvec[i]) misses.push_back(i);
         }
-        blkvec.push_back(blks);
     }
 
+    // Read the remaining regions (e.g. a data variable and its
+    // coordinate variables) on this thread. Reads from the DC are
+    // serialized by _readMutex, so fetching them concurrently gains
+    // little, and would deadlock when this thread already holds
+    // _readMutex because it is reading a derived variable
     //
-    // Safe to remove locks now that were not explicitly requested
+    bool failed = false;
+    for (int j = 0; j < misses.size() && !failed; j++) {
+        int i = misses[j];
+        blkvec[i] = _get_region<T>(tsvec[i], varnames[i], level, lod, nlodsvec[i], dimsvec[i], bsvec[i], bminvec[i], bmaxvec[i], true, contain, rbminvec[i], rbmaxvec[i]);
+        failed = !blkvec[i];
+    }
+
     //
-    if (!lock) {
+    // Safe to remove locks now that were not explicitly requested, or
+    // all of them if any of the regions could not be read
+    //
+    if (!lock || failed) {
+        std::unique_lock<std::shared_mutex> guard(_regionsMutex);
         for (int i = 0; i < blkvec.size(); i++) {
             if (blkvec[i]) _unlock_blocks(blkvec[i]);
         }
     }
+    if (failed) {
+        blkvec.assign(varnames.size(), NULL);
+        return (-1);
+    }
     return (0);
 }
 
@@ -2041,7 +3374,7 @@ void *DataMgr::_alloc_region(size_t ts, string varname, int level, int lod, Dims
 
     void *blks;
     while (!(blks = (void *)_blk_mem_mgr->Alloc(nblocks, fill))) {
-        if (!_free_lru()) {
+        if (backgroundThread || !_evict_region()) {
             SetErrMsg("Failed to allocate requested memory");
             return (NULL);
         }
@@ -2049,76 +3382,260 @@ void *DataMgr::_alloc_region(size_t ts, string varname, int level, int lod, Dims
 
     region_t region;
 
-    region.ts = ts;
+    region.key = _make_region_key(ts, varname, level, lod, bmin, bmax);
     region.varname = varname;
-    region.level = level;
-    region.lod = lod;
-    region.bmin = bmin;
-    region.bmax = bmax;
     region.lock_counter = lock ? 1 : 0;
+    region.loading = false;
     region.blks = blks;
+    region.nbytes = nblocks * mem_block_size;
+    region.cost = 0.0;
+    region.priority = 0.0;
 
-    _regionsList.push_back(region);
+    std::list<region_t> &list = lock ? _lockedRegionsList : _regionsList;
+    region_itr_t         itr = list.insert(list.end(), region);
+    if (!lock) _set_evictable(itr);
+
+    _regionsIndex[region.key] = itr;
+    _regionsBlksIndex[region.blks] = itr;
+
+    auto transient = _transientRegions.find(std::this_thread::get_id());
+    if (transient != _transientRegions.end()) transient->second.push_back(region.key);
+
+    region_key_t group_key = region.key;
+    group_key.bmin = group_key.bmax = {0, 0, 0};
+    _regionsGroupIndex[group_key].push_back(itr);
 
     return (region.blks);
 }
 
-void DataMgr::_free_region(size_t ts, string varname, int level, int lod, DimsType bmin, DimsType bmax, bool forceFlag)
+void DataMgr::_erase_region(region_itr_t itr)
 {
-    list<region_t>::iterator itr;
-    for (itr = _regionsList.begin(); itr != _regionsList.end(); itr++) {
-        const region_t &region = *itr;
+    const region_t &region = *itr;
 
-        if (region.ts == ts && region.varname.compare(varname) == 0 && region.level == level && region.lod == lod && region.bmin == bmin && region.bmax == bmax) {
-            if (region.lock_counter == 0 || forceFlag) {
-                if (region.blks) _blk_mem_mgr->FreeMem(region.blks);
+    if (region.blks) _blk_mem_mgr->FreeMem(region.blks);
 
-                _regionsList.erase(itr);
-                return;
-            }
-        }
+    _regionsIndex.erase(region.key);
+    _regionsBlksIndex.erase(region.blks);
+
+    region_key_t group_key = region.key;
+    group_key.bmin = group_key.bmax = {0, 0, 0};
+    auto group = _regionsGroupIndex.find(group_key);
+    if (group != _regionsGroupIndex.end()) {
+        vector<region_itr_t> &members = group->second;
+        members.erase(std::find(members.begin(), members.end(), itr));
+        if (members.empty()) _regionsGroupIndex.erase(group);
+    }
+
+    if (region.lock_counter > 0) {
+        _lockedRegionsList.erase(itr);
+    } else {
+        _regionsPriority.erase(std::make_pair(region.priority, (const void *)region.blks));
+        _regionsList.erase(itr);
     }
+}
+
+void DataMgr::_free_region(size_t ts, string varname, int level, int lod, DimsType bmin, DimsType bmax, bool forceFlag)
+{
+    auto idx = _regionsIndex.find(_make_region_key(ts, varname, level, lod, bmin, bmax));
+    if (idx == _regionsIndex.end()) return;
 
-    return;
+    if (idx->second->lock_counter == 0 || forceFlag) { _erase_region(idx->second); }
 }
 
 void DataMgr::_free_var(string varname)
 {
-    list<region_t>::iterator itr;
-    for (itr = _regionsList.begin(); itr != _regionsList.end();) {
-        const region_t &region = *itr;
+    size_t varid = _varNameId(varname);
+
+    std::unique_lock<std::mutex>        spillGuard(_spillMutex);
+    std::unique_lock<std::shared_mutex> guard(_regionsMutex);
+    for (auto list : {&_regionsList, &_lockedRegionsList}) {
+        for (region_itr_t itr = list->begin(); itr != list->end();) {
+            region_itr_t next = std::next(itr);
+            if (itr->key.varid == varid) _erase_region(itr);
+            itr = next;
+        }
+    }
+    _pendingSpills.erase(std::remove_if(_pendingSpills.begin(), _pendingSpills.end(), [&varname](const spill_t &spill) { return (spill.varname == varname); }), _pendingSpills.end());
+    guard.unlock();
 
-        if (region.varname.compare(varname) == 0) {
-            if (region.blks) _blk_mem_mgr->FreeMem(region.blks);
+    _spillCache.Purge(varname);
+    spillGuard.unlock();
 
-            _regionsList.erase(itr);
-            itr = _regionsList.begin();
-        } else
-            itr++;
+    std::unique_lock<std::mutex> blkRangesGuard(_blkRangesCacheMutex);
+    for (auto itr = _blkRangesCache.begin(); itr != _blkRangesCache.end();) {
+        if (itr->second.varname == varname)
+            itr = _blkRangesCache.erase(itr);
+        else
+            ++itr;
     }
+    blkRangesGuard.unlock();
 
     _varInfoCacheSize_T.Purge(vector<string>(1, varname));
     _varInfoCacheDouble.Purge(vector<string>(1, varname));
     _varInfoCacheVoidPtr.Purge(vector<string>(1, varname));
 }
 
-bool DataMgr::_free_lru()
+void DataMgr::_set_evictable(region_itr_t itr)
 {
-    // The least recently used region is at the front of the list
+    region_t &region = *itr;
+
+    // GreedyDual-Size: a region's priority is its cost per byte, offset
+    // by the priority of the last region evicted so that regions that
+    // have not been used recently age out regardless of their cost
     //
-    list<region_t>::iterator itr;
-    for (itr = _regionsList.begin(); itr != _regionsList.end(); itr++) {
-        const region_t &region = *itr;
+    _regionsPriority.erase(std::make_pair(region.priority, (const void *)region.blks));
+    region.priority = _evictionAge + (region.cost / (double)std::max(region.nbytes, (size_t)1));
+    _regionsPriority.insert(std::make_pair(region.priority, (const void *)region.blks));
+}
 
-        if (region.lock_counter == 0) {
-            if (region.blks) _blk_mem_mgr->FreeMem(region.blks);
-            _regionsList.erase(itr);
-            return (true);
+void DataMgr::_demote_region(const region_key_t &key)
+{
+    std::unique_lock<std::shared_mutex> guard(_regionsMutex);
+
+    auto idx = _regionsIndex.find(key);
+    if (idx == _regionsIndex.end()) return;
+
+    region_itr_t itr = idx->second;
+    if (itr->lock_counter > 0 || itr->loading) return;
+
+    // Make the region the next to be evicted under either policy. With
+    // no cost it is also never spilled
+    //
+    itr->cost = 0.0;
+    _regionsList.splice(_regionsList.begin(), _regionsList, itr);
+    _set_evictable(itr);
+}
+
+bool DataMgr::_evict_region()
+{
+    // Locked regions are never on the list, nor in the priority set
+    //
+    if (_regionsList.empty()) return (false);
+
+    region_itr_t itr;
+    if (_evictionPolicy == LRU) {
+        // The least recently used region is at the front of the list.
+        //
+        itr = _regionsList.begin();
+    } else {
+        VAssert(!_regionsPriority.empty());
+        _evictionAge = _regionsPriority.begin()->first;
+        itr = _regionsBlksIndex[_regionsPriority.begin()->second];
+    }
+    VAssert(itr->lock_counter == 0);
+
+    if (!isSubMesh(itr->varname)) {
+        CacheStats &stats = _cacheStats[itr->varname];
+        stats.evictions++;
+        stats.bytesEvicted += itr->nbytes;
+    }
+
+    // Keep a copy in the spill cache if the region costs more to
+    // produce than it does to write to, and read back from, the spill
+    // cache. The copy is written by _flush_spills() after _regionsMutex
+    // is released
+    //
+    if (_spillCache.Enabled() && itr->cost / (double)std::max(itr->nbytes, (size_t)1) > _spillSecondsPerByte + _spillWriteSecondsPerByte) {
+        spill_t spill;
+        spill.key = _spill_key(*itr);
+        spill.varname = itr->varname;
+        spill.data.reset(new (std::nothrow) unsigned char[itr->nbytes]);
+        spill.nbytes = itr->nbytes;
+        if (spill.data) {
+            memcpy(spill.data.get(), itr->blks, itr->nbytes);
+            _pendingSpills.push_back(std::move(spill));
         }
     }
 
-    // nothing to free
-    return (false);
+    _erase_region(itr);
+    return (true);
+}
+
+string DataMgr::_spill_key(const region_t &region) const
+{
+    const region_key_t &key = region.key;
+
+    ostringstream oss;
+    oss << _fingerprint << ":" << region.varname << ":" << key.ts << ":" << key.level << ":" << key.lod << ":" << vector_to_string(key.bmin) << vector_to_string(key.bmax);
+    return (oss.str());
+}
+
+void DataMgr::_flush_spills()
+{
+    std::unique_lock<std::mutex>        spillGuard(_spillMutex);
+    std::unique_lock<std::shared_mutex> guard(_regionsMutex);
+    if (_pendingSpills.empty()) return;
+
+    std::vector<spill_t> spills;
+    spills.swap(_pendingSpills);
+    guard.unlock();
+
+    std::vector<bool> stored;
+    auto              start = std::chrono::steady_clock::now();
+    size_t            nbytes = 0;
+    for (const auto &spill : spills) {
+        stored.push_back(_spillCache.Put(spill.key, spill.varname, spill.data.get(), spill.nbytes));
+        nbytes += spill.nbytes;
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    guard.lock();
+    for (size_t i = 0; i < spills.size(); i++) {
+        if (stored[i]) _cacheStats[spills[i].varname].bytesSpilled += spills[i].nbytes;
+    }
+    double secondsPerByte = seconds / (double)std::max(nbytes, (size_t)1);
+    _spillWriteSecondsPerByte = _spillWriteSecondsPerByte > 0.0 ? 0.5 * (_spillWriteSecondsPerByte + secondsPerByte) : secondsPerByte;
+}
+
+int DataMgr::SetSpillCache(string dir, size_t maxMB)
+{
+    std::unique_lock<std::mutex>        spillGuard(_spillMutex);
+    std::unique_lock<std::shared_mutex> guard(_regionsMutex);
+    _pendingSpills.clear();
+    _spillSecondsPerByte = 0.0;
+    _spillWriteSecondsPerByte = 0.0;
+    guard.unlock();
+
+    int rc = _spillCache.Initialize(dir, maxMB * 1024 * 1024);
+    if (rc < 0 || dir.empty()) return (rc);
+
+    // Seed the cost estimates by writing a probe block to the spill
+    // cache and reading it back. Until then no region would be judged
+    // cheaper to reproduce than to spill
+    //
+    const string               probeKey = "__spillProbe";
+    size_t                     nbytes = std::min((size_t)4 * 1024 * 1024, maxMB * 1024 * 1024);
+    std::vector<unsigned char> probe(nbytes, 0);
+
+    auto start = std::chrono::steady_clock::now();
+    bool ok = _spillCache.Put(probeKey, probeKey, probe.data(), nbytes);
+    auto mid = std::chrono::steady_clock::now();
+    ok = ok && _spillCache.Get(probeKey, probe.data(), nbytes);
+    auto end = std::chrono::steady_clock::now();
+    _spillCache.Purge(probeKey);
+
+    if (ok) {
+        guard.lock();
+        _spillWriteSecondsPerByte = std::chrono::duration<double>(mid - start).count() / (double)nbytes;
+        _spillSecondsPerByte = std::chrono::duration<double>(end - mid).count() / (double)nbytes;
+    }
+    return (0);
+}
+
+int DataMgr::SetLocatorCache(string dir) { return (_gridHelper.SetLocatorCache(dir)); }
+
+void DataMgr::SetCellLocator(UnstructuredGrid::CellLocator locator) { _gridHelper.SetCellLocator(locator); }
+
+void DataMgr::SetEvictionPolicy(EvictionPolicy policy)
+{
+    std::unique_lock<std::shared_mutex> guard(_regionsMutex);
+    _evictionPolicy = policy;
+}
+
+DataMgr::EvictionPolicy DataMgr::GetEvictionPolicy() const
+{
+    std::shared_lock<std::shared_mutex> guard(_regionsMutex);
+    return (_evictionPolicy);
 }
 
 //
@@ -2126,6 +3643,8 @@ bool DataMgr::_free_lru()
 //
 vector<string> DataMgr::_get_native_variables() const
 {
+    readLock_t readGuard(_readMutex);
+
     vector<string> v1 = _dc->GetDataVarNames();
     vector<string> v2 = _dc->GetCoordVarNames();
     vector<string> v3 = _dc->GetAuxVarNames();
@@ -2271,89 +3790,101 @@ bool DataMgr::_isCoordVarInUse(string varName) const
     return (false);
 }
 
-template<typename C> string DataMgr::VarInfoCache<C>::_make_hash(string key, size_t ts, vector<string> varnames, int level, int lod)
+template<typename C> size_t DataMgr::VarInfoCache<C>::key_hash_t::operator()(const key_t &key) const
 {
-    ostringstream oss;
+    size_t seed = std::hash<size_t>()(key.ts);
+    hash_combine(seed, std::hash<size_t>()(key.varsid));
+    hash_combine(seed, std::hash<size_t>()(key.keyid));
+    hash_combine(seed, std::hash<int>()(key.level));
+    hash_combine(seed, std::hash<int>()(key.lod));
+    for (int i = 0; i < key.min.size(); i++) {
+        hash_combine(seed, std::hash<size_t>()(key.min[i]));
+        hash_combine(seed, std::hash<size_t>()(key.max[i]));
+    }
+    return (seed);
+}
+
+template<typename C> size_t DataMgr::VarInfoCache<C>::_id(const string &name) const
+{
+    {
+        std::shared_lock<std::shared_mutex> guard(_idsMutex);
+        auto                                itr = _ids.find(name);
+        if (itr != _ids.end()) return (itr->second);
+    }
 
-    oss << key << ":";
-    oss << ts << ":";
-    for (int i = 0; i < varnames.size(); i++) { oss << varnames[i] << ":"; }
-    oss << level << ":";
-    oss << lod;
+    std::unique_lock<std::shared_mutex> guard(_idsMutex);
+    auto                                itr = _ids.find(name);
+    if (itr != _ids.end()) return (itr->second);
 
-    return (oss.str());
+    size_t id = _ids.size();
+    _ids[name] = id;
+    return (id);
 }
 
-template<typename C> void DataMgr::VarInfoCache<C>::_decode_hash(const string &hash, string &key, size_t &ts, vector<string> &varnames, int &level, int &lod)
+template<typename C> size_t DataMgr::VarInfoCache<C>::_id(const vector<string> &names) const
 {
-    varnames.clear();
-
-    stringstream   ss(hash);
-    vector<string> result;
+    if (names.size() == 1) return (_id(names[0]));
 
-    // parse hash into vector of strings
+    // Lists are interned by their NUL separated concatenation, which
+    // can't collide with a single name
     //
-    while (ss.good()) {
-        string substr;
-        getline(ss, substr, ':');
-        result.push_back(substr);
+    string joined;
+    for (int i = 0; i < names.size(); i++) {
+        joined += names[i];
+        joined += '\0';
     }
-    VAssert(result.size() >= 5);
-
-    int i = 0;
-    key = result[i++];
-    ts = (size_t)stoi(result[i++]);
-    while (!is_int(result[i])) { varnames.push_back(result[i++]); }
-    level = stoi(result[i++]);
-    lod = stoi(result[i++]);
+    return (_id(joined));
 }
 
-template<typename C> void DataMgr::VarInfoCache<C>::Set(size_t ts, vector<string> varnames, int level, int lod, string key, const vector<C> &values)
+template<typename C> void DataMgr::VarInfoCache<C>::_set(const key_t &key, const vector<C> &values)
 {
-    string hash = _make_hash(key, ts, varnames, level, lod);
-    _cache[hash] = values;
+    shard_t &                   shard = _shard(key);
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    shard.cache[key] = values;
 }
 
-template<typename C> bool DataMgr::VarInfoCache<C>::Get(size_t ts, vector<string> varnames, int level, int lod, string key, vector<C> &values) const
+template<typename C> bool DataMgr::VarInfoCache<C>::_get(const key_t &key, vector<C> &values) const
 {
     values.clear();
 
-    string                                          hash = _make_hash(key, ts, varnames, level, lod);
-    typename map<string, vector<C>>::const_iterator itr = _cache.find(hash);
+    shard_t &                   shard = _shard(key);
+    std::lock_guard<std::mutex> guard(shard.mutex);
 
-    if (itr == _cache.end()) return (false);
+    auto itr = shard.cache.find(key);
+    if (itr == shard.cache.end()) return (false);
 
     values = itr->second;
     return (true);
 }
 
-template<typename C> void DataMgr::VarInfoCache<C>::Purge(size_t ts, vector<string> varnames, int level, int lod, string key)
+template<typename C> void DataMgr::VarInfoCache<C>::Purge(size_t ts, const vector<string> &varnames, int level, int lod, const string &key)
 {
-    string                                    hash = _make_hash(key, ts, varnames, level, lod);
-    typename map<string, vector<C>>::iterator itr = _cache.find(hash);
-
-    if (itr == _cache.end()) return;
-
-    _cache.erase(itr);
+    key_t                       k = _make_key(ts, _id(varnames), level, lod, key);
+    shard_t &                   shard = _shard(k);
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    shard.cache.erase(k);
 }
 
-template<typename C> void DataMgr::VarInfoCache<C>::Purge(vector<string> varnames)
+template<typename C> void DataMgr::VarInfoCache<C>::Purge(const vector<string> &varnames)
 {
-    vector<string>                                 hashes;
-    typename map<string, std::vector<C>>::iterator itr;
-    for (itr = _cache.begin(); itr != _cache.end(); ++itr) { hashes.push_back(itr->first); }
+    size_t varsid = _id(varnames);
 
-    for (int i = 0; i < hashes.size(); i++) {
-        string         hash = hashes[i];
-        string         key;
-        size_t         ts;
-        vector<string> cvarnames;
-        int            level;
-        int            lod;
-
-        _decode_hash(hash, key, ts, cvarnames, level, lod);
+    for (auto &shard : _shards) {
+        std::lock_guard<std::mutex> guard(shard.mutex);
+        for (auto itr = shard.cache.begin(); itr != shard.cache.end();) {
+            if (itr->first.varsid == varsid)
+                itr = shard.cache.erase(itr);
+            else
+                ++itr;
+        }
+    }
+}
 
-        if (varnames == cvarnames) { Purge(ts, varnames, level, lod, key); }
+template<typename C> void DataMgr::VarInfoCache<C>::Clear()
+{
+    for (auto &shard : _shards) {
+        std::lock_guard<std::mutex> guard(shard.mutex);
+        shard.cache.clear();
     }
 }
 
@@ -2567,6 +4098,8 @@ void DataMgr::_ugrid_setup(const DC::DataVar &var, DimsType &vertexDims, DimsTyp
                            UnstructuredGrid::Location &location,    // node,face, edge
                            size_t &maxVertexPerFace, size_t &maxFacePerVertex, long &vertexOffset, long &faceOffset, long ts) const
 {
+    readLock_t readGuard(_readMutex);
+
     vertexDims = {1, 1, 1};
     faceDims = {1, 1, 1};
     edgeDims = {1, 1, 1};
@@ -2701,15 +4234,18 @@ int DataMgr::_find_bounding_grid(size_t ts, string varname, int level, int lod,
         return (-1);
     }
 
-    // Currently unstructured grids can not be subset. We always need
-    // to read the entire data set.
+    // Unstructured grids can only be subset along the node dimension,
+    // and only if they have a spatial index over their faces. Otherwise
+    // we need to read the entire data set.
     //
     if (_gridHelper.IsUnstructured(_get_grid_type(varname))) {
         for (int i = 0; i < dims_at_level.size(); i++) {
             min_ui[i] = 0;
             max_ui[i] = dims_at_level[i] - 1;
         }
-        return (0);
+        if (!_sub_mesh_supported(varname)) return (0);
+
+        return (_find_bounding_sub_mesh(ts, varname, level, lod, min, max, min_ui, max_ui));
     }
 
     DimsType bs = {1, 1, 1};
@@ -2717,14 +4253,19 @@ int DataMgr::_find_bounding_grid(size_t ts, string varname, int level, int lod,
 
     // hash tag for block coordinate cache
     //
-    string hash = VarInfoCache<int>::_make_hash("BlkExts", hash_ts, scvars, level, lod);
+    string cvarsname;
+    for (const auto &cvar : scvars) cvarsname += cvar + '\0';
+    region_key_t hash = _make_region_key(hash_ts, cvarsname, level, lod, {0, 0, 0}, {0, 0, 0});
 
     // See if bounding volumes for individual blocks are already
     // cached for this grid
     //
-    map<string, BlkExts>::iterator itr = _blkExtsCache.find(hash);
+    std::unique_lock<std::mutex> blkExtsGuard(_blkExtsCacheMutex);
+    auto                         itr = _blkExtsCache.find(hash);
 
     if (itr == _blkExtsCache.end()) {
+        blkExtsGuard.unlock();
+
         SetDiagMsg("DataMgr::_find_bounding_grid() - coordinates not in cache");
 
         // Get a "dataless" Grid - a Grid class the contains
@@ -2784,15 +4325,21 @@ int DataMgr::_find_bounding_grid(size_t ts, string varname, int level, int lod,
 
         // Add to the hash table
         //
-        _blkExtsCache[hash] = blkexts;
-        itr = _blkExtsCache.find(hash);
-        VAssert(itr != _blkExtsCache.end());
+        // Another thread may have computed the same extents in the
+        // meantime. Don't replace an entry that may be in use.
+        //
+        blkExtsGuard.lock();
+        itr = _blkExtsCache.insert(std::make_pair(hash, blkexts)).first;
 
     } else {
         SetDiagMsg("DataMgr::_find_bounding_grid() - coordinates in cache");
     }
 
+    // Entries are never removed from _blkExtsCache, so the reference
+    // remains valid after the lock is released
+    //
     const BlkExts &blkexts = itr->second;
+    blkExtsGuard.unlock();
 
 
 
@@ -2812,18 +4359,241 @@ int DataMgr::_find_bounding_grid(size_t ts, string varname, int level, int lod,
     return (0);
 }
 
-void DataMgr::_unlock_blocks(const void *blks)
+bool DataMgr::_sub_mesh_supported(string varname) const
+{
+    string gridType = _get_grid_type(varname);
+    if (gridType != UnstructuredGrid2D::GetClassType() && gridType != UnstructuredGridLayered::GetClassType()) return (false);
+
+    DC::DataVar dvar;
+    bool        ok = GetDataVarInfo(varname, dvar);
+    if (!ok || dvar.GetSamplingLocation() != DC::Mesh::NODE) return (false);
+
+    // Edge connectivity is not remapped into sub-meshes
+    //
+    string face_node_var;
+    string node_face_var;
+    string face_edge_var;
+    string face_face_var;
+    string edge_node_var;
+    string edge_face_var;
+
+    ok = _getVarConnVars(varname, face_node_var, node_face_var, face_edge_var, face_face_var, edge_node_var, edge_face_var);
+    if (!ok) return (false);
+
+    return (!face_node_var.empty() && face_edge_var.empty() && edge_node_var.empty() && edge_face_var.empty());
+}
+
+int DataMgr::_find_bounding_sub_mesh(size_t ts, string varname, int level, int lod, const CoordType &min, const CoordType &max, DimsType &min_ui, DimsType &max_ui)
+{
+    // Get a "dataless" Grid for the entire mesh. Its cell locator, a
+    // QuadTreeRectangle or BVHRectangle spatial index over the faces, is
+    // cached by the GridHelper
+    //
+    Grid *rg = _getVariable(ts, varname, level, lod, true, true);
+    if (!rg) return (-1);
+
+    std::shared_ptr<const QuadTreeRectangleP> qtr;
+    std::shared_ptr<const BVHRectangle>       bvh;
+    if (UnstructuredGrid2D *ug = dynamic_cast<UnstructuredGrid2D *>(rg)) {
+        qtr = ug->GetQuadTreeRectangle();
+        bvh = ug->GetBVHRectangle();
+    } else if (UnstructuredGridLayered *ug = dynamic_cast<UnstructuredGridLayered *>(rg)) {
+        qtr = ug->GetQuadTreeRectangle();
+        bvh = ug->GetBVHRectangle();
+    }
+    VAssert(qtr || bvh);
+
+    vector<DimsType> faces;
+    if (bvh) {
+        bvh->GetPayloadIntersected(min[0], min[1], max[0], max[1], faces);
+    } else {
+        qtr->GetPayloadIntersected(min[0], min[1], max[0], max[1], faces);
+    }
+
+    // The locator query is conservative. Only keep faces whose
+    // bounding rectangle actually intersects the box. For layered grids
+    // the nodes of the bottom layer define the horizontal footprint.
+    //
+    size_t           nmin = std::numeric_limits<size_t>::max();
+    size_t           nmax = 0;
+    vector<DimsType> nodes;
+    for (const auto &face : faces) {
+        if (!rg->GetCellNodes(DimsType{face[0], 0, 0}, nodes) || nodes.empty()) continue;
+
+        CoordType fmin = {std::numeric_limits<double>::max(), std::numeric_limits<double>::max(), 0.0};
+        CoordType fmax = {std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest(), 0.0};
+        for (const auto &node : nodes) {
+            CoordType coord;
+            rg->GetUserCoordinates(node, coord);
+            for (int i = 0; i < 2; i++) {
+                fmin[i] = std::min(fmin[i], coord[i]);
+                fmax[i] = std::max(fmax[i], coord[i]);
+            }
+        }
+        if (fmin[0] > max[0] || fmax[0] < min[0] || fmin[1] > max[1] || fmax[1] < min[1]) continue;
+
+        for (const auto &node : nodes) {
+            nmin = std::min(nmin, node[0]);
+            nmax = std::max(nmax, node[0]);
+        }
+    }
+
+    UnlockGrid(rg);
+    delete rg;
+
+    if (nmin > nmax) return (1);
+
+    // Only the node dimension is subset. Layers are always read in full
+    //
+    min_ui[0] = nmin;
+    max_ui[0] = nmax;
+
+    return (0);
+}
+
+int *DataMgr::_get_sub_mesh(size_t ts, string varname, int level, int lod, const vector<string> &conn_varnames, const vector<DimsType> &conn_dimsvec, const vector<DimsType> &conn_bsvec,
+                            const vector<DimsType> &conn_bminvec, const vector<DimsType> &conn_bmaxvec, size_t nodeBlkMin, size_t nodeBlkMax, size_t n0, size_t n1, const DimsType &faceDims,
+                            size_t maxVertexPerFace, size_t maxFacePerVertex, long vertexOffset, long faceOffset)
 {
-    list<region_t>::iterator itr;
-    for (itr = _regionsList.begin(); itr != _regionsList.end(); itr++) {
-        region_t &region = *itr;
+    // Sub-meshes are cached like any other region, under a name derived
+    // from the face-node connectivity variable and keyed by the
+    // node block range. Like the connectivity variables they are built
+    // from, they are keyed by time step 0 if these aren't time varying
+    //
+    string   name = subMeshPrefix + conn_varnames[0];
+    DimsType bmin = {nodeBlkMin, 0, 0};
+    DimsType bmax = {nodeBlkMax, 0, 0};
+    DimsType rbmin, rbmax;
+
+    size_t region_ts = 0;
+    for (const auto &conn_varname : conn_varnames) {
+        if (IsTimeVarying(conn_varname)) region_ts = ts;
+    }
+
+    {
+        std::unique_lock<std::shared_mutex> guard(_regionsMutex);
+        int *                               blks = _get_region_from_cache<int>(region_ts, name, level, lod, bmin, bmax, true, false, rbmin, rbmax);
+        if (blks) return (blks);
+    }
+
+    string face_node_var;
+    string node_face_var;
+    string face_face_var;
+    string dummy;
+
+    bool ok = _getVarConnVars(varname, face_node_var, node_face_var, dummy, face_face_var, dummy, dummy);
+    VAssert(ok);
+
+    vector<int *>    conn_blkvec;
+    vector<DimsType> conn_rbminvec;
+    vector<DimsType> conn_rbmaxvec;
+    int              rc = DataMgr::_get_regions<int>(ts, conn_varnames, level, lod, true, false, conn_dimsvec, conn_bsvec, conn_bminvec, conn_bmaxvec, conn_blkvec, conn_rbminvec, conn_rbmaxvec);
+    if (rc < 0) return (NULL);
+
+    const int *faceNode = NULL;
+    const int *nodeFace = NULL;
+    const int *faceFace = NULL;
+    for (int i = 0; i < conn_varnames.size(); i++) {
+        if (conn_varnames[i] == face_node_var) faceNode = conn_blkvec[i];
+        if (conn_varnames[i] == node_face_var) nodeFace = conn_blkvec[i];
+        if (conn_varnames[i] == face_face_var) faceFace = conn_blkvec[i];
+    }
+    VAssert(faceNode);
+
+    vector<int> subFaceNode, subNodeFace, subFaceFace;
+    size_t      nfaces = DataMgrUtils::MakeSubMesh(faceNode, nodeFace, faceFace, faceDims[0], maxVertexPerFace, maxFacePerVertex, vertexOffset, faceOffset, n0, n1, subFaceNode, subNodeFace, subFaceFace);
 
-        if (region.blks == blks && region.lock_counter > 0) {
-            region.lock_counter--;
-            return;
+    // The sub-mesh holds the connectivity variables in the order of
+    // conn_varnames
+    //
+    vector<int> submesh;
+    submesh.push_back((int)nfaces);
+    for (int i = 0; i < conn_varnames.size(); i++) {
+        if (conn_varnames[i] == face_node_var) {
+            submesh.insert(submesh.end(), subFaceNode.begin(), subFaceNode.end());
+        } else if (conn_varnames[i] == node_face_var) {
+            submesh.insert(submesh.end(), subNodeFace.begin(), subNodeFace.end());
+        } else if (conn_varnames[i] == face_face_var) {
+            submesh.insert(submesh.end(), subFaceFace.begin(), subFaceFace.end());
         }
     }
-    return;
+
+    std::unique_lock<std::shared_mutex> guard(_regionsMutex);
+    for (int i = 0; i < conn_blkvec.size(); i++) {
+        if (conn_blkvec[i]) _unlock_blocks(conn_blkvec[i]);
+    }
+
+    // Another thread may have built the same sub-mesh in the meantime
+    //
+    int *blks = _get_region_from_cache<int>(region_ts, name, level, lod, bmin, bmax, true, false, rbmin, rbmax);
+    if (blks) return (blks);
+
+    // The region is filled before the mutex is released, so that no
+    // other thread finds it in the cache before it is complete
+    //
+    size_t   nblks = nodeBlkMax - nodeBlkMin + 1;
+    DimsType bs = {(submesh.size() + nblks - 1) / nblks, 1, 1};
+    blks = (int *)_alloc_region(region_ts, name, level, lod, bmin, bmax, bs, sizeof(int), true, false);
+    if (blks) std::copy(submesh.begin(), submesh.end(), blks);
+    guard.unlock();
+    _flush_spills();
+    return (blks);
+}
+
+void DataMgr::_unlock_blocks(const void *blks)
+{
+    auto idx = _regionsBlksIndex.find(blks);
+    if (idx == _regionsBlksIndex.end()) return;
+
+    region_itr_t itr = idx->second;
+    region_t &   region = *itr;
+    if (region.lock_counter == 0) return;
+
+    // Once the last lock is released the region becomes the most
+    // recently used eviction candidate
+    //
+    region.lock_counter--;
+    if (region.lock_counter == 0) {
+        _regionsList.splice(_regionsList.end(), _lockedRegionsList, itr);
+        _set_evictable(itr);
+    }
+}
+
+size_t DataMgr::_varNameId(const string &varname) const
+{
+    std::lock_guard<std::mutex> guard(_varNameIdsMutex);
+
+    auto itr = _varNameIds.find(varname);
+    if (itr != _varNameIds.end()) return (itr->second);
+
+    size_t id = _varNameIds.size();
+    _varNameIds[varname] = id;
+    return (id);
+}
+
+DataMgr::region_key_t DataMgr::_make_region_key(size_t ts, const string &varname, int level, int lod, const DimsType &bmin, const DimsType &bmax) const
+{
+    region_key_t key;
+    key.ts = ts;
+    key.varid = _varNameId(varname);
+    key.level = level;
+    key.lod = lod;
+    key.bmin = bmin;
+    key.bmax = bmax;
+    return (key);
+}
+
+size_t DataMgr::region_key_hash_t::operator()(const region_key_t &key) const
+{
+    size_t seed = std::hash<size_t>()(key.ts);
+    hash_combine(seed, std::hash<size_t>()(key.varid));
+    hash_combine(seed, std::hash<int>()(key.level));
+    hash_combine(seed, std::hash<int>()(key.lod));
+    for (int i = 0; i < key.bmin.size(); i++) {
+        hash_combine(seed, std::hash<size_t>()(key.bmin[i]));
+        hash_combine(seed, std::hash<size_t>()(key.bmax[i]));
+    }
+    return (seed);
 }
 
 vector<string> DataMgr::_getDataVarNamesDerived(int ndim) const
@@ -2899,7 +4669,10 @@ bool DataMgr::_getVarDimensions(string varname, vector<DC::Dimension> &dimension
 {
     dimensions.clear();
 
-    if (!IsVariableDerived(varname)) { return (_dc->GetVarDimensions(varname, true, dimensions, ts)); }
+    if (!IsVariableDerived(varname)) {
+        readLock_t readGuard(_readMutex);
+        return (_dc->GetVarDimensions(varname, true, dimensions, ts));
+    }
 
     if (_getDerivedDataVar(varname)) {
         return (_getDataVarDimensions(varname, dimensions, ts));
@@ -2940,7 +4713,7 @@ bool DataMgr::_getDataVarDimensions(string varname, vector<DC::Dimension> &dimen
     for (int i = 0; i < dimnames.size(); i++) {
         DC::Dimension dim;
 
-        status = _dc->GetDimension(dimnames[i], dim, ts);
+        status = GetDimension(dimnames[i], dim, ts);
         if (!status) return (false);
 
         dimensions.push_back(dim);
@@ -2961,7 +4734,7 @@ bool DataMgr::_getCoordVarDimensions(string varname, vector<DC::Dimension> &dime
 
     for (int i = 0; i < dimnames.size(); i++) {
         DC::Dimension dim;
-        status = _dc->GetDimension(dimnames[i], dim, ts);
+        status = GetDimension(dimnames[i], dim, ts);
         if (!status) return (false);
 
         dimensions.push_back(dim);
@@ -3041,12 +4814,16 @@ DerivedCoordVar *DataMgr::_getDerivedCoordVar(string varname) const
 
 int DataMgr::_openVariableRead(size_t ts, string varname, int level, int lod)
 {
-    _openVarName = varname;
-
-    DerivedVar *derivedVar = _getDerivedVar(_openVarName);
-    if (derivedVar) { return (derivedVar->OpenVariableRead(ts, level, lod)); }
+    int         fd;
+    DerivedVar *derivedVar = _getDerivedVar(varname);
+    if (derivedVar) {
+        fd = derivedVar->OpenVariableRead(ts, level, lod);
+    } else {
+        fd = _dc->OpenVariableRead(ts, varname, level, lod);
+    }
 
-    return (_dc->OpenVariableRead(ts, _openVarName, level, lod));
+    if (fd >= 0) _openVarNames.push_back(varname);
+    return (fd);
 }
 
 
@@ -3058,8 +4835,10 @@ template<class T> int DataMgr::_readRegion(int fd, const DimsType &min, const Di
     Grid::CopyFromArr3(max, maxv);
     maxv.resize(ndims);
 
+    VAssert(!_openVarNames.empty());
+
     int         rc = 0;
-    DerivedVar *derivedVar = _getDerivedVar(_openVarName);
+    DerivedVar *derivedVar = _getDerivedVar(_openVarNames.back());
     if (derivedVar) {
         VAssert((std::is_same<T, float>::value) == true);
         rc = derivedVar->ReadRegion(fd, minv, maxv, (float *)region);
@@ -3073,16 +4852,21 @@ template<class T> int DataMgr::_readRegion(int fd, const DimsType &min, const Di
 
 int DataMgr::_closeVariable(int fd)
 {
-    DerivedVar *derivedVar = _getDerivedVar(_openVarName);
-    if (derivedVar) { return (derivedVar->CloseVariable(fd)); }
+    VAssert(!_openVarNames.empty());
+
+    string varname = _openVarNames.back();
+    _openVarNames.pop_back();
 
-    _openVarName.clear();
+    DerivedVar *derivedVar = _getDerivedVar(varname);
+    if (derivedVar) { return (derivedVar->CloseVariable(fd)); }
 
     return (_dc->CloseVariable(fd));
 }
 
 template<class T> int DataMgr::_getVar(string varname, int level, int lod, T *data)
 {
+    readLock_t readGuard(_readMutex);
+
     vector<size_t> dims_at_level, dummy;
 
     size_t numts = _dc->GetNumTimeSteps(varname);
@@ -3105,6 +4889,8 @@ template<class T> int DataMgr::_getVar(string varname, int level, int lod, T *da
 
 template<class T> int DataMgr::_getVar(size_t ts, string varname, int level, int lod, T *data)
 {
+    readLock_t readGuard(_readMutex);
+
     vector<size_t> dims_at_level, dummy;
     int            rc = _dc->GetDimLensAtLevel(varname, level, dims_at_level, dummy, ts);
     if (rc < 0) return (-1);
@@ -154,27 +154,13 @@ int DataMgrUtils::GetGrids(DataMgr *dataMgr, size_t ts, const vector<string> &va
         }
     }
 
-    // Now obtain a regular grid for each valid variable
+    // Now obtain a grid for each valid variable. The variables are read
+    // concurrently, and on failure no grids are returned
     //
-    for (int i = 0; i < varnames.size(); i++) {
-        if (varnames[i].empty()) continue;
-
-        Grid *rGrid = dataMgr->GetVariable(ts, varnames[i], *refLevel, *lod, minExtsReq, maxExtsReq, true);
-
-        if (!rGrid) {
-            for (int j = 0; j < i; j++) {
-                if (grids[j]) dataMgr->UnlockGrid(grids[j]);
-            }
-            MyBase::SetErrMsg("Error retrieving variable data");
-            return -1;
-        }
-        grids[i] = rGrid;
-    }
-
-    if (!lock) {
-        for (auto g : grids) {
-            if (g) dataMgr->UnlockGrid(g);
-        }
+    int rc = dataMgr->GetVariables(ts, varnames, *refLevel, *lod, minExtsReq, maxExtsReq, lock, grids);
+    if (rc < 0) {
+        MyBase::SetErrMsg("Error retrieving variable data");
+        return -1;
     }
 
     // obtained all of the grids needed
@@ -410,6 +396,77 @@ bool DataMgrUtils::GetFirstExistingVariable(DataMgr *dataMgr, size_t ts, int lev
     return (false);
 }
 
+size_t DataMgrUtils::MakeSubMesh(const int *faceNode, const int *nodeFace, const int *faceFace, size_t nfaces, size_t maxVertexPerFace, size_t maxFacePerVertex, long vertexOffset,
+                                 long faceOffset, size_t n0, size_t n1, vector<int> &subFaceNode, vector<int> &subNodeFace, vector<int> &subFaceFace)
+{
+    const int missingID = -1;
+    const int boundaryID = -2;
+
+    subFaceNode.clear();
+    subNodeFace.clear();
+    subFaceFace.clear();
+
+    // Faces are kept if all of their nodes lie in [n0, n1]. faceMap maps
+    // the index of a kept face in the mesh to its index in the sub-mesh
+    //
+    vector<long> faceMap(nfaces, -1);
+    vector<long> keptFaces;
+    for (size_t f = 0; f < nfaces; f++) {
+        const int *ptr = faceNode + f * maxVertexPerFace;
+        bool       keep = false;
+        for (size_t k = 0; k < maxVertexPerFace; k++) {
+            if (ptr[k] == missingID) break;
+            if (ptr[k] == boundaryID) continue;
+
+            long idx = ptr[k] + vertexOffset;
+            if (idx < 0) break;
+            keep = idx >= (long)n0 && idx <= (long)n1;
+            if (!keep) break;
+        }
+        if (!keep) continue;
+
+        faceMap[f] = keptFaces.size();
+        keptFaces.push_back(f);
+    }
+
+    auto remapFace = [&](int id) {
+        if (id == missingID || id == boundaryID) return (id);
+
+        long idx = id + faceOffset;
+        if (idx < 0 || idx >= (long)faceMap.size()) return (missingID);
+
+        // Faces outside of the sub-mesh become its boundary
+        //
+        return (faceMap[idx] < 0 ? boundaryID : (int)faceMap[idx]);
+    };
+
+    for (auto f : keptFaces) {
+        for (size_t k = 0; k < maxVertexPerFace; k++) {
+            int id = faceNode[f * maxVertexPerFace + k];
+            if (id == missingID || id == boundaryID) {
+                subFaceNode.push_back(id);
+            } else {
+                long idx = id + vertexOffset;
+                subFaceNode.push_back(idx < 0 ? missingID : (int)(idx - n0));
+            }
+        }
+    }
+
+    if (nodeFace) {
+        for (size_t n = n0; n <= n1; n++) {
+            for (size_t k = 0; k < maxFacePerVertex; k++) { subNodeFace.push_back(remapFace(nodeFace[n * maxFacePerVertex + k])); }
+        }
+    }
+
+    if (faceFace) {
+        for (auto f : keptFaces) {
+            for (size_t k = 0; k < maxVertexPerFace; k++) { subFaceFace.push_back(remapFace(faceFace[f * maxVertexPerFace + k])); }
+        }
+    }
+
+    return (keptFaces.size());
+}
+
 #ifdef VAPOR3_0_0_ALPHA
 // Map corners of box to voxels.
 void DataMgrUtils::mapBoxToVox(Box *box, string varname, int refLevel, int lod, int timestep, size_t voxExts[6])
@@ -17,6 +17,7 @@
 
 #include <vapor/utils.h>
 #include <vapor/Grid.h>
+#include <vapor/GridTraversal.h>
 #include <vapor/OpenMPSupport.h>
 
 using namespace std;
@@ -204,56 +205,24 @@ void Grid::SetValueIJK(size_t i, size_t j, size_t k, float v)
 
 void Grid::GetRange(float range[2]) const
 {
-    const auto missingVal = GetMissingValue();
-    const auto num_vals = _dims[0] * _dims[1] * _dims[2];
-    auto num_threads = size_t{1};
-#pragma omp parallel
-    {
-      if (omp_get_thread_num() == 0)
-        num_threads = omp_get_num_threads();
-    }
-    const auto stride_size = num_vals / num_threads;
-
-    auto min_vec = std::vector<float>(num_threads, missingVal);
-    auto max_vec = std::vector<float>(num_threads, missingVal);
-
-#pragma omp parallel for
-    for (size_t i = 0; i < num_threads; i++) {
-      auto beg = this->cbegin() + i * stride_size;
-      auto end = beg;
-      if (i < num_threads - 1) 
-        end += stride_size;
-      else
-        end = this->cend();
-
-      while (*beg == missingVal && beg != end)
-        ++beg;
-
-      if (beg != end) {
-        auto min = *beg;
-        auto max = *beg;
-        for (auto itr  = beg + 1; itr != end; ++itr) {
-          if (*itr != missingVal) {
-            min = std::min(*itr, min);      
-            max = std::max(*itr, max);      
-          }
-        }
-        min_vec[i] = min;
-        max_vec[i] = max;
-      }
-    } // finish omp section
-
-    if (std::all_of(min_vec.begin(), min_vec.end(), 
-        [missingVal](float v){return v == missingVal;})) {
-      range[0] = missingVal;
-      range[1] = missingVal;
-    }
-    else {
-      auto it = std::remove(min_vec.begin(), min_vec.end(), missingVal);
-      range[0] = *std::min_element(min_vec.begin(), it);
-      it = std::remove(max_vec.begin(), max_vec.end(), missingVal);
-      range[1] = *std::max_element(max_vec.begin(), it);
+    using minmax_t = std::array<float, 2>;
+
+    const float    inf = std::numeric_limits<float>::infinity();
+    const minmax_t empty = {inf, -inf};
+
+    minmax_t mm = Reduce(
+        *this, empty, [](minmax_t acc, float v) { return (minmax_t{std::min(acc[0], v), std::max(acc[1], v)}); },
+        [](const minmax_t &a, const minmax_t &b) { return (minmax_t{std::min(a[0], b[0]), std::max(a[1], b[1])}); });
+
+    // No valid values
+    //
+    if (mm[0] > mm[1]) {
+        range[0] = range[1] = GetMissingValue();
+        return;
     }
+
+    range[0] = mm[0];
+    range[1] = mm[1];
 }
 
 void Grid::GetRange(const DimsType &min, const DimsType &max, float range[2]) const
@@ -306,6 +275,14 @@ float Grid::GetValue(const CoordType &coords) const
 }
 
 
+void Grid::GetValues(const double *xyz, size_t n, float *values) const
+{
+    for (size_t p = 0; p < n; p++) {
+        CoordType coords = {xyz[3 * p], xyz[3 * p + 1], xyz[3 * p + 2]};
+        values[p] = GetValue(coords);
+    }
+}
+
 void Grid::GetUserCoordinates(size_t i, double &x, double &y, double &z) const
 {
     x = y = z = 0.0;
@@ -413,6 +390,64 @@ float Grid::TrilinearInterpolate(size_t i, size_t j, size_t k, const double xwgt
     return (v0 * zwgt + v1 * (1.0 - zwgt));
 }
 
+float Grid::TrilinearInterpolateBlocked(size_t i, size_t j, size_t k, const double xwgt, const double ywgt, const double zwgt) const
+{
+    if (_dims[0] < 2 || _dims[1] < 2 || !_blks.size()) return (TrilinearInterpolate(i, j, k, xwgt, ywgt, zwgt));
+
+    VAssert(i < _dims[0]);
+    VAssert(j < _dims[1]);
+    VAssert(k < _dims[2]);
+
+    // Far corner of the cell, clamped to the grid as AccessIJK() would
+    //
+    bool   twoLayers = _dims[2] > 1 && k < (_dims[2] - 1);
+    size_t i1 = i < _dims[0] - 1 ? i + 1 : i;
+    size_t j1 = j < _dims[1] - 1 ? j + 1 : j;
+    size_t k1 = twoLayers ? k + 1 : k;
+
+    auto nodePtr = [this](size_t ii, size_t jj, size_t kk) {
+        const float *blk = _blks[(kk / _bs[2]) * _bdims[0] * _bdims[1] + (jj / _bs[1]) * _bdims[0] + (ii / _bs[0])];
+        return (blk + ((kk % _bs[2]) * _bs[1] + (jj % _bs[1])) * _bs[0] + (ii % _bs[0]));
+    };
+
+    float verts[8];
+    if (i / _bs[0] == i1 / _bs[0] && j / _bs[1] == j1 / _bs[1] && k / _bs[2] == k1 / _bs[2]) {
+        const float *ptr = nodePtr(i, j, k);
+        size_t       di = i1 - i;
+        size_t       dj = (j1 - j) * _bs[0];
+        size_t       dk = (k1 - k) * _bs[0] * _bs[1];
+        verts[0] = ptr[0];
+        verts[1] = ptr[di];
+        verts[2] = ptr[dj];
+        verts[3] = ptr[di + dj];
+        verts[4] = ptr[dk];
+        verts[5] = ptr[dk + di];
+        verts[6] = ptr[dk + dj];
+        verts[7] = ptr[dk + di + dj];
+    } else {
+        verts[0] = *nodePtr(i, j, k);
+        verts[1] = *nodePtr(i1, j, k);
+        verts[2] = *nodePtr(i, j1, k);
+        verts[3] = *nodePtr(i1, j1, k);
+        verts[4] = *nodePtr(i, j, k1);
+        verts[5] = *nodePtr(i1, j, k1);
+        verts[6] = *nodePtr(i, j1, k1);
+        verts[7] = *nodePtr(i1, j1, k1);
+    }
+
+    int   nverts = twoLayers ? 8 : 4;
+    float mv = GetMissingValue();
+    for (int v = 0; v < nverts; v++) {
+        if (verts[v] == mv) return (TrilinearInterpolate(i, j, k, xwgt, ywgt, zwgt));
+    }
+
+    float v0 = ((verts[0] * xwgt + verts[1] * (1.0 - xwgt)) * ywgt) + ((verts[2] * xwgt + verts[3] * (1.0 - xwgt)) * (1.0 - ywgt));
+    if (!twoLayers) return (v0);
+
+    float v1 = ((verts[4] * xwgt + verts[5] * (1.0 - xwgt)) * ywgt) + ((verts[6] * xwgt + verts[7] * (1.0 - xwgt)) * (1.0 - ywgt));
+    return (v0 * zwgt + v1 * (1.0 - zwgt));
+}
+
 /////////////////////////////////////////////////////////////////////////////
 //
 // Iterators
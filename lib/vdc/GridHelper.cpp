@@ -22,6 +22,36 @@ template<class T> string vector_to_string(T v)
     return (oss.str());
 }
 
+// Append the address and size of a value, or of the valid elements of
+// a grid's blocks, to a list of buffers to be passed to
+// LocatorCache::Fingerprint()
+//
+template<class T> void appendBuffer(vector<std::pair<const void *, size_t>> &buffers, const T &value) { buffers.push_back({&value, sizeof(value)}); }
+
+// Only the elements of blocks of size bs with indices inside dims are
+// appended, one row at a time. The padding at the far end of the last
+// block along each axis is never initialized
+//
+template<class T> void appendBuffers(vector<std::pair<const void *, size_t>> &buffers, const vector<T *> &blkptrs, const DimsType &bs, const DimsType &dims)
+{
+    DimsType bdims;
+    for (int i = 0; i < bdims.size(); i++) bdims[i] = (dims[i] + bs[i] - 1) / bs[i];
+
+    for (size_t b = 0; b < blkptrs.size() && b < bdims[0] * bdims[1] * bdims[2]; b++) {
+        DimsType bcoord = {b % bdims[0], (b / bdims[0]) % bdims[1], b / (bdims[0] * bdims[1])};
+        DimsType n;
+        for (int i = 0; i < n.size(); i++) n[i] = std::min(bs[i], dims[i] - bcoord[i] * bs[i]);
+
+        if (n[0] == bs[0] && n[1] == bs[1]) {
+            buffers.push_back({blkptrs[b], n[0] * n[1] * n[2] * sizeof(T)});
+            continue;
+        }
+        for (size_t k = 0; k < n[2]; k++) {
+            for (size_t j = 0; j < n[1]; j++) buffers.push_back({blkptrs[b] + (k * bs[1] + j) * bs[0], n[0] * sizeof(T)});
+        }
+    }
+}
+
 bool isUnstructured2D(const DC::Mesh &m, const vector<DC::CoordVar> &cvarsinfo, const vector<vector<string>> &cdimnames)
 {
     DC::Mesh::Type mtype = m.GetMeshType();
@@ -100,12 +130,111 @@ bool isCurvilinear(const DC::Mesh &m, const vector<DC::CoordVar> &cvarsinfo, con
     return (true);
 }
 
+// Compute pointers to each of the blocks in the region bmin..bmax of a
+// blocked variable. The blocks are stored contiguously, starting at
+// blks, in the order of the enclosing region rbmin..rbmax.
+//
+// N.B. a one-dimensional variable's blocks are always contiguous and
+// may be accessed as a flat array starting at the first block pointer
+//
+vector<float *> get_blk_ptrs(float *blks, const DimsType &bs, const DimsType &bmin, const DimsType &bmax, const DimsType &rbmin, const DimsType &rbmax)
+{
+    vector<float *> blkptrs;
+    if (!blks) return (blkptrs);
+
+    size_t   block_size = 1;
+    DimsType rbdims;
+    for (int i = 0; i < bs.size(); i++) {
+        VAssert(rbmin[i] <= bmin[i] && bmax[i] <= rbmax[i]);
+        block_size *= bs[i];
+        rbdims[i] = rbmax[i] - rbmin[i] + 1;
+    }
+
+    for (size_t k = bmin[2]; k <= bmax[2]; k++) {
+        for (size_t j = bmin[1]; j <= bmax[1]; j++) {
+            for (size_t i = bmin[0]; i <= bmax[0]; i++) {
+                size_t offset = ((k - rbmin[2]) * rbdims[1] + (j - rbmin[1])) * rbdims[0] + (i - rbmin[0]);
+                blkptrs.push_back(blks + offset * block_size);
+            }
+        }
+    }
+    return (blkptrs);
+}
 
 };    // namespace
 
 using namespace VAPoR;
 using namespace Wasp;
 
+template<class T>
+std::shared_ptr<const T> GridHelper::_getLocator(lru_cache<string, std::shared_ptr<const T>> &cache, std::map<string, std::weak_ptr<const T>> &live, const string &key)
+{
+    std::unique_lock<std::mutex> guard(_qtrMutex);
+
+    for (;;) {
+        std::shared_ptr<const T> locator = cache.get(key);
+        if (locator) return (locator);
+
+        // Locators evicted from the LRU cache may still be in use
+        //
+        auto itr = live.find(key);
+        if (itr != live.end()) {
+            locator = itr->second.lock();
+            if (locator) {
+                (void)cache.put(key, locator);
+                return (locator);
+            }
+            live.erase(itr);
+        }
+
+        if (!_qtrBuilding.count(key)) {
+            _qtrBuilding.insert(key);
+            return (nullptr);
+        }
+        _qtrBuilt.wait(guard);
+    }
+}
+
+template<class T>
+void GridHelper::_putLocator(lru_cache<string, std::shared_ptr<const T>> &cache, std::map<string, std::weak_ptr<const T>> &live, const string &key, std::shared_ptr<const T> locator)
+{
+    std::unique_lock<std::mutex> guard(_qtrMutex);
+
+    (void)cache.put(key, locator);
+
+    for (auto itr = live.begin(); itr != live.end();) {
+        if (itr->second.expired()) {
+            itr = live.erase(itr);
+        } else {
+            ++itr;
+        }
+    }
+    live[key] = locator;
+
+    _qtrBuilding.erase(key);
+    _qtrBuilt.notify_all();
+}
+
+std::shared_ptr<const QuadTreeRectangleP> GridHelper::_getQuadTreeRectangle(const string &key) { return (_getLocator(_qtrCache, _qtrLive, key)); }
+
+void GridHelper::_putQuadTreeRectangle(const string &key, std::shared_ptr<const QuadTreeRectangleP> qtr) { _putLocator(_qtrCache, _qtrLive, key, qtr); }
+
+std::shared_ptr<const BVHRectangle> GridHelper::_getBVHRectangle(const string &key) { return (_getLocator(_bvhCache, _bvhLive, key)); }
+
+void GridHelper::_putBVHRectangle(const string &key, std::shared_ptr<const BVHRectangle> bvh) { _putLocator(_bvhCache, _bvhLive, key, bvh); }
+
+GridHelper::qtrClaim_t::~qtrClaim_t()
+{
+    if (_key.empty()) return;
+
+    std::unique_lock<std::mutex> guard(_gh->_qtrMutex);
+
+    // Already released by _putQuadTreeRectangle() unless construction
+    // of the locator failed
+    //
+    if (_gh->_qtrBuilding.erase(_key)) _gh->_qtrBuilt.notify_all();
+}
+
 string GridHelper::_getQuadTreeRectangleKey(size_t ts, int level, int lod, const vector<DC::CoordVar> &cvarsinfo, const DimsType &bmin, const DimsType &bmax) const
 {
     VAssert(cvarsinfo.size() >= 2);
@@ -128,6 +257,8 @@ string GridHelper::_getQuadTreeRectangleKey(size_t ts, int level, int lod, const
     oss << ":";
     oss << level;
     oss << ":";
+    oss << lod;
+    oss << ":";
     oss << vector_to_string(bmin);
     oss << ":";
     oss << vector_to_string(bmax);
@@ -135,169 +266,106 @@ string GridHelper::_getQuadTreeRectangleKey(size_t ts, int level, int lod, const
     return (oss.str());
 }
 
-RegularGrid *GridHelper::_make_grid_regular(const DimsType &dims, const vector<float *> &blkvec, const DimsType &bs, const DimsType &bmin, const DimsType &bmax
-
-) const
+RegularGrid *GridHelper::_make_grid_regular(const DimsType &dims, const vector<vector<float *>> &blkptrsvec, const DimsType &bs) const
 {
     CoordType minu = {0.0, 0.0, 0.0};
     CoordType maxu = {0.0, 0.0, 0.0};
-    for (int i = 0; i < blkvec.size() - 1 && blkvec[i + 1]; i++) {
+    for (int i = 0; i < blkptrsvec.size() - 1 && blkptrsvec[i + 1].size(); i++) {
         VAssert(dims[i] > 0);
-        float *coords = blkvec[i + 1];
+        const float *coords = blkptrsvec[i + 1][0];
         minu[i] = (coords[0]);
         maxu[i] = (coords[dims[i] - 1]);
     }
 
-    size_t nblocks = 1;
-    size_t block_size = 1;
-    for (int i = 0; i < bs.size(); i++) {
-        nblocks *= bmax[i] - bmin[i] + 1;
-        block_size *= bs[i];
-    }
-
-    vector<float *> blkptrs;
-    if (blkvec[0]) {
-        for (int i = 0; i < nblocks; i++) { blkptrs.push_back(blkvec[0] + i * block_size); }
-    }
-
-    RegularGrid *rg = new RegularGrid(dims, bs, blkptrs, minu, maxu);
+    RegularGrid *rg = new RegularGrid(dims, bs, blkptrsvec[0], minu, maxu);
 
     return (rg);
 }
 
-StretchedGrid *GridHelper::_make_grid_stretched(const DimsType &dims, const vector<float *> &blkvec, const DimsType &bs, const DimsType &bmin, const DimsType &bmax
-
-) const
+StretchedGrid *GridHelper::_make_grid_stretched(const DimsType &dims, const vector<vector<float *>> &blkptrsvec, const DimsType &bs) const
 {
-    size_t nblocks = 1;
-    size_t block_size = 1;
-    for (int i = 0; i < bs.size(); i++) {
-        nblocks *= bmax[i] - bmin[i] + 1;
-        block_size *= bs[i];
-    }
-
-    vector<float *> blkptrs;
-    if (blkvec[0]) {
-        for (int i = 0; i < nblocks; i++) { blkptrs.push_back(blkvec[0] + i * block_size); }
-    }
-
     vector<double> xcoords;
-    if (blkvec.size() > 1 && blkvec[1]) {
-        for (int i = 0; i < dims[0]; i++) xcoords.push_back(blkvec[1][i]);
+    if (blkptrsvec.size() > 1 && blkptrsvec[1].size()) {
+        for (int i = 0; i < dims[0]; i++) xcoords.push_back(blkptrsvec[1][0][i]);
     }
 
     vector<double> ycoords;
-    if (blkvec.size() > 2 && blkvec[2]) {
-        for (int i = 0; i < dims[1]; i++) ycoords.push_back(blkvec[2][i]);
+    if (blkptrsvec.size() > 2 && blkptrsvec[2].size()) {
+        for (int i = 0; i < dims[1]; i++) ycoords.push_back(blkptrsvec[2][0][i]);
     }
 
     vector<double> zcoords;
-    if (blkvec.size() > 3 && blkvec[3]) {
-        for (int i = 0; i < dims[2]; i++) zcoords.push_back(blkvec[3][i]);
+    if (blkptrsvec.size() > 3 && blkptrsvec[3].size()) {
+        for (int i = 0; i < dims[2]; i++) zcoords.push_back(blkptrsvec[3][0][i]);
     }
 
-    StretchedGrid *sg = new StretchedGrid(dims, bs, blkptrs, xcoords, ycoords, zcoords);
+    StretchedGrid *sg = new StretchedGrid(dims, bs, blkptrsvec[0], xcoords, ycoords, zcoords);
 
     return (sg);
 }
 
-LayeredGrid *GridHelper::_make_grid_layered(const DimsType &dims, const vector<float *> &blkvec, const DimsType &bs, const DimsType &bmin, const DimsType &bmax) const
+LayeredGrid *GridHelper::_make_grid_layered(const DimsType &dims, const vector<vector<float *>> &blkptrsvec, const DimsType &bs) const
 {
     // Get horizontal dimensions
     //
     vector<double> xcoords;
-    for (int i = 0; i < dims[0]; i++) xcoords.push_back(blkvec[1][i]);
+    for (int i = 0; i < dims[0]; i++) xcoords.push_back(blkptrsvec[1][0][i]);
 
     vector<double> ycoords;
-    for (int i = 0; i < dims[1]; i++) ycoords.push_back(blkvec[2][i]);
-
-    // Data blocks
-    //
-    size_t nblocks = 1;
-    size_t block_size = 1;
-    for (int i = 0; i < bs.size(); i++) {
-        nblocks *= bmax[i] - bmin[i] + 1;
-        block_size *= bs[i];
-    }
-
-    vector<float *> blkptrs, zcblkptrs;
-
-    if (blkvec[0]) {
-        for (int i = 0; i < nblocks; i++) { blkptrs.push_back(blkvec[0] + i * block_size); }
-    }
+    for (int i = 0; i < dims[1]; i++) ycoords.push_back(blkptrsvec[2][0][i]);
 
     // Z Coord blocks
     //
-    nblocks = 1;
-    block_size = 1;
-    for (int i = 0; i < bs.size(); i++) {
-        nblocks *= bmax[i] - bmin[i] + 1;
-        block_size *= bs[i];
-    }
-    for (int i = 0; i < nblocks; i++) { zcblkptrs.push_back(blkvec[3] + i * block_size); }
+    RegularGrid rg(dims, bs, blkptrsvec[3], CoordType{0.0, 0.0, 0.0}, CoordType{1.0, 1.0, 1.0});
 
-    RegularGrid rg(dims, bs, zcblkptrs, CoordType{0.0, 0.0, 0.0}, CoordType{1.0, 1.0, 1.0});
-
-    LayeredGrid *lg = new LayeredGrid(dims, bs, blkptrs, xcoords, ycoords, rg);
+    LayeredGrid *lg = new LayeredGrid(dims, bs, blkptrsvec[0], xcoords, ycoords, rg);
 
     return (lg);
 }
 
-CurvilinearGrid *GridHelper::_make_grid_curvilinear(size_t ts, int level, int lod, const vector<DC::CoordVar> &cvarsinfo, const DimsType &dims, const vector<float *> &blkvec, const DimsType &bs,
-                                                    const DimsType &bmin, const DimsType &bmax)
+CurvilinearGrid *GridHelper::_make_grid_curvilinear(size_t ts, int level, int lod, const vector<DC::CoordVar> &cvarsinfo, const DimsType &dims, const vector<vector<float *>> &blkptrsvec,
+                                                    const DimsType &bs, const DimsType &bmin, const DimsType &bmax)
 {
-
-    // Data blocks
+    // X and Y horizontal coord blocks
     //
-    size_t nblocks = 1;
-    size_t block_size = 1;
-    for (int i = 0; i < bs.size(); i++) {
-        nblocks *= bmax[i] - bmin[i] + 1;
-        block_size *= bs[i];
-    }
+    DimsType bs2d = {bs[0], bs[1], 1};
+    DimsType bmin2d = {bmin[0], bmin[1], 0};
+    DimsType bmax2d = {bmax[0], bmax[1], 0};
 
-    // block pointers for data
-    //
-    vector<float *> blkptrs;
-    for (int i = 0; i < nblocks; i++) {
-        if (blkvec[0]) blkptrs.push_back(blkvec[0] + i * block_size);
-    }
-
-    // X horizontal coord blocks
-    //
-    DimsType       bs2d = {bs[0], bs[1], 1};
-    DimsType       bmin2d = {bmin[0], bmin[1], 0};
-    DimsType       bmax2d = {bmax[0], bmax[1], 0};
-    size_t         nblocks2d = 1;
-    size_t         block_size2d = 1;
-    for (int i = 0; i < bs2d.size(); i++) {
-        nblocks2d *= bmax2d[i] - bmin2d[i] + 1;
-        block_size2d *= bs2d[i];
-    }
-
-    vector<float *> xcblkptrs;
-    for (int i = 0; i < nblocks2d; i++) { xcblkptrs.push_back(blkvec[1] + i * block_size2d); }
-
-    // Y horizontal coord blocks
-    //
-    vector<float *> ycblkptrs;
-    for (int i = 0; i < nblocks2d; i++) { ycblkptrs.push_back(blkvec[2] + i * block_size2d); }
-
-    CoordType      minu2d = {0.0, 0.0, 0.0};
-    CoordType      maxu2d = {1.0, 1.0, 1.0};
-    DimsType       dims2d = {dims[0], dims[1], 1};
-    RegularGrid    xrg(dims2d, bs2d, xcblkptrs, minu2d, maxu2d);
-    RegularGrid    yrg(dims2d, bs2d, ycblkptrs, minu2d, maxu2d);
+    CoordType   minu2d = {0.0, 0.0, 0.0};
+    CoordType   maxu2d = {1.0, 1.0, 1.0};
+    DimsType    dims2d = {dims[0], dims[1], 1};
+    RegularGrid xrg(dims2d, bs2d, blkptrsvec[1], minu2d, maxu2d);
+    RegularGrid yrg(dims2d, bs2d, blkptrsvec[2], minu2d, maxu2d);
 
     string qtr_key = _getQuadTreeRectangleKey(ts, level, lod, cvarsinfo, bmin2d, bmax2d);
 
     // Try to get a shared pointer to the QuadTreeRectangle from the
     // cache. If one does not exist the Grid class will make one. We use
-    // a shared pointer so that we can cache it for use by other Grid
-    // classes. This a peformance optimization, necessary be creating
-    // a QuadTreeRectangle is expensive.
+    // a shared pointer so that we can share it with other Grid
+    // classes built on the same coordinates. This a peformance
+    // optimization, necessary be creating a QuadTreeRectangle is expensive.
+    //
+    std::shared_ptr<const QuadTreeRectangleP> qtr = _getQuadTreeRectangle(qtr_key);
+    bool                                      inMemory = qtr != nullptr;
+    qtrClaim_t                                claim(this, inMemory ? "" : qtr_key);
+
+    // Not in memory. Before having the grid build one, try the locator
+    // cache, where the tree is keyed by the horizontal coordinates
     //
-    std::shared_ptr<const QuadTreeRectangleP> qtr = _qtrCache.get(qtr_key);
+    string fingerprint;
+    if (!inMemory && _locatorCache.Enabled()) {
+        vector<std::pair<const void *, size_t>> buffers;
+        appendBuffer(buffers, dims2d);
+        appendBuffer(buffers, bs2d);
+        appendBuffer(buffers, bmin2d);
+        appendBuffer(buffers, bmax2d);
+        appendBuffers(buffers, blkptrsvec[1], bs2d, dims2d);
+        appendBuffers(buffers, blkptrsvec[2], bs2d, dims2d);
+        fingerprint = LocatorCache::Fingerprint(buffers);
+
+        qtr = _locatorCache.GetQuadTreeRectangle(fingerprint);
+    }
 
     CurvilinearGrid *g;
     if (Grid::GetNumDimensions(dims) == 3 && cvarsinfo[2].GetDimNames().size() == 3) {
@@ -306,33 +374,30 @@ CurvilinearGrid *GridHelper::_make_grid_curvilinear(size_t ts, int level, int lo
         CoordType minu = {0.0, 0.0, 0.0};
         CoordType maxu = {1.0, 1.0, 1.0};
 
-        vector<float *> zcblkptrs;
-        for (int i = 0; i < nblocks; i++) { zcblkptrs.push_back(blkvec[3] + i * block_size); }
+        RegularGrid zrg(dims, bs, blkptrsvec[3], minu, maxu);
 
-        RegularGrid zrg(dims, bs, zcblkptrs, minu, maxu);
-
-        g = new CurvilinearGrid(dims, bs, blkptrs, xrg, yrg, zrg, qtr);
+        g = new CurvilinearGrid(dims, bs, blkptrsvec[0], xrg, yrg, zrg, qtr);
 
     } else if (Grid::GetNumDimensions(dims) == 3 && cvarsinfo[2].GetDimNames().size() == 1) {
         // stretched vertical
         //
         vector<double> zcoords;
-        for (int i = 0; i < dims[2]; i++) zcoords.push_back(blkvec[3][i]);
+        for (int i = 0; i < dims[2]; i++) zcoords.push_back(blkptrsvec[3][0][i]);
 
-        g = new CurvilinearGrid(dims, bs, blkptrs, xrg, yrg, zcoords, qtr);
+        g = new CurvilinearGrid(dims, bs, blkptrsvec[0], xrg, yrg, zcoords, qtr);
     } else {
         // 2D
         //
-        g = new CurvilinearGrid(dims, bs, blkptrs, xrg, yrg, vector<double>(), qtr);
+        g = new CurvilinearGrid(dims, bs, blkptrsvec[0], xrg, yrg, vector<double>(), qtr);
     }
 
     // No QuadTreeRectangle in cache. So get shared pointer for one created
     // by UnstructuredGrid2D() and cache it for later use. The memory
     // will be garbage collected when all pointers to it go out of scope
     //
-    if (!qtr) {
-        qtr = g->GetQuadTreeRectangle();
-        (void)_qtrCache.put(qtr_key, qtr);
+    if (!inMemory) {
+        if (!qtr && !fingerprint.empty()) (void)_locatorCache.PutQuadTreeRectangle(fingerprint, *g->GetQuadTreeRectangle());
+        _putQuadTreeRectangle(qtr_key, g->GetQuadTreeRectangle());
     }
 
     return (g);
@@ -382,26 +447,68 @@ UnstructuredGrid2D *GridHelper::_make_grid_unstructured2d(size_t ts, int level,
 
     UnstructuredGridCoordless zug;
 
+    UnstructuredGrid::CellLocator locator = _cellLocator;
+
     string qtr_key = _getQuadTreeRectangleKey(ts, level, lod, cvarsinfo, bmin, bmax);
+    if (locator == UnstructuredGrid::BVH) qtr_key += ":bvh";
+
+    // Try to get a shared pointer to the QuadTreeRectangle, or the
+    // BVHRectangle if that locator is selected, from the cache. If one
+    // does not exist the Grid class will make one. We use
+    // a shared pointer so that we can share it with other Grid
+    // classes built on the same coordinates. This a peformance
+    // optimization, necessary be creating a QuadTreeRectangle is expensive.
+    //
+    std::shared_ptr<const QuadTreeRectangleP> qtr;
+    std::shared_ptr<const BVHRectangle>       bvh;
+    if (locator == UnstructuredGrid::BVH) {
+        bvh = _getBVHRectangle(qtr_key);
+    } else {
+        qtr = _getQuadTreeRectangle(qtr_key);
+    }
+    bool       inMemory = qtr || bvh;
+    qtrClaim_t claim(this, inMemory ? "" : qtr_key);
 
-    // Try to get a shared pointer to the QuadTreeRectangle from the
-    // cache. If one does not exist the Grid class will make one. We use
-    // a shared pointer so that we can cache it for use by other Grid
-    // classes. This a peformance optimization, necessary be creating
-    // a QuadTreeRectangle is expensive.
+    // Not in memory. Before having the grid build one, try the locator
+    // cache, where the locator is keyed by the horizontal coordinates and
+    // the face connectivity
     //
-    std::shared_ptr<const QuadTreeRectangleP> qtr = _qtrCache.get(qtr_key);
+    string fingerprint;
+    if (!inMemory && _locatorCache.Enabled()) {
+        vector<std::pair<const void *, size_t>> buffers;
+        appendBuffer(buffers, vertexDims);
+        appendBuffer(buffers, faceDims);
+        appendBuffer(buffers, bmin);
+        appendBuffer(buffers, bmax);
+        appendBuffer(buffers, location);
+        appendBuffer(buffers, maxVertexPerFace);
+        appendBuffer(buffers, vertexOffset);
+        appendBuffer(buffers, faceOffset);
+        appendBuffers(buffers, xcblkptrs, bs, vertexDims);
+        appendBuffers(buffers, ycblkptrs, bs, vertexDims);
+        buffers.push_back({vertexOnFace, faceDims[0] * maxVertexPerFace * sizeof(*vertexOnFace)});
+        fingerprint = LocatorCache::Fingerprint(buffers);
+
+        if (locator == UnstructuredGrid::BVH) {
+            bvh = _locatorCache.GetBVHRectangle(fingerprint);
+        } else {
+            qtr = _locatorCache.GetQuadTreeRectangle(fingerprint);
+        }
+    }
 
     UnstructuredGrid2D *g = new UnstructuredGrid2D(vertexDims, faceDims, edgeDims, bs, blkptrs, vertexOnFace, faceOnVertex, faceOnFace, location, maxVertexPerFace, maxFacePerVertex, vertexOffset,
-                                                   faceOffset, xug, yug, zug, qtr);
+                                                   faceOffset, xug, yug, zug, qtr, bvh, locator);
 
-    // No QuadTreeRectangle in cache. So get shared pointer for one created
+    // No locator in cache. So get shared pointer for one created
     // by UnstructuredGrid2D() and cache it for later use. The memory
     // will be garbage collected when all pointers to it go out of scope
     //
-    if (!qtr) {
-        qtr = g->GetQuadTreeRectangle();
-        (void)_qtrCache.put(qtr_key, qtr);
+    if (!inMemory && locator == UnstructuredGrid::BVH) {
+        if (!bvh && !fingerprint.empty()) (void)_locatorCache.PutBVHRectangle(fingerprint, *g->GetBVHRectangle());
+        _putBVHRectangle(qtr_key, g->GetBVHRectangle());
+    } else if (!inMemory) {
+        if (!qtr && !fingerprint.empty()) (void)_locatorCache.PutQuadTreeRectangle(fingerprint, *g->GetQuadTreeRectangle());
+        _putQuadTreeRectangle(qtr_key, g->GetQuadTreeRectangle());
     }
 
     return (g);
@@ -478,26 +585,68 @@ UnstructuredGridLayered *GridHelper::_make_grid_unstructured_layered(size_t ts,
 
     UnstructuredGridCoordless zug(vertexDims, faceDims, edgeDims, bs, zcblkptrs, 3, vertexOnFace, faceOnVertex, faceOnFace, location, maxVertexPerFace, maxFacePerVertex, vertexOffset, faceOffset);
 
+    UnstructuredGrid::CellLocator locator = _cellLocator;
+
     string qtr_key = _getQuadTreeRectangleKey(ts, level, lod, cvarsinfo, bmin, bmax);
+    if (locator == UnstructuredGrid::BVH) qtr_key += ":bvh";
+
+    // Try to get a shared pointer to the QuadTreeRectangle, or the
+    // BVHRectangle if that locator is selected, from the cache. If one
+    // does not exist the Grid class will make one. We use
+    // a shared pointer so that we can share it with other Grid
+    // classes built on the same coordinates. This a peformance
+    // optimization, necessary be creating a QuadTreeRectangle is expensive.
+    //
+    std::shared_ptr<const QuadTreeRectangleP> qtr;
+    std::shared_ptr<const BVHRectangle>       bvh;
+    if (locator == UnstructuredGrid::BVH) {
+        bvh = _getBVHRectangle(qtr_key);
+    } else {
+        qtr = _getQuadTreeRectangle(qtr_key);
+    }
+    bool       inMemory = qtr || bvh;
+    qtrClaim_t claim(this, inMemory ? "" : qtr_key);
 
-    // Try to get a shared pointer to the QuadTreeRectangle from the
-    // cache. If one does not exist the Grid class will make one. We use
-    // a shared pointer so that we can cache it for use by other Grid
-    // classes. This a peformance optimization, necessary be creating
-    // a QuadTreeRectangle is expensive.
+    // Not in memory. Before having the grid build one, try the locator
+    // cache, where the locator is keyed by the horizontal coordinates and
+    // the face connectivity
     //
-    std::shared_ptr<const QuadTreeRectangleP> qtr = _qtrCache.get(qtr_key);
+    string fingerprint;
+    if (!inMemory && _locatorCache.Enabled()) {
+        vector<std::pair<const void *, size_t>> buffers;
+        appendBuffer(buffers, vertexDims);
+        appendBuffer(buffers, faceDims);
+        appendBuffer(buffers, bmin);
+        appendBuffer(buffers, bmax);
+        appendBuffer(buffers, location);
+        appendBuffer(buffers, maxVertexPerFace);
+        appendBuffer(buffers, vertexOffset);
+        appendBuffer(buffers, faceOffset);
+        appendBuffers(buffers, xcblkptrs, bs1D, vertexDims1D);
+        appendBuffers(buffers, ycblkptrs, bs1D, vertexDims1D);
+        buffers.push_back({vertexOnFace, faceDims[0] * maxVertexPerFace * sizeof(*vertexOnFace)});
+        fingerprint = LocatorCache::Fingerprint(buffers);
+
+        if (locator == UnstructuredGrid::BVH) {
+            bvh = _locatorCache.GetBVHRectangle(fingerprint);
+        } else {
+            qtr = _locatorCache.GetQuadTreeRectangle(fingerprint);
+        }
+    }
 
     UnstructuredGridLayered *g = new UnstructuredGridLayered(vertexDims, faceDims, edgeDims, bs, blkptrs, vertexOnFace, faceOnVertex, faceOnFace, location, maxVertexPerFace, maxFacePerVertex,
-                                                             vertexOffset, faceOffset, xug, yug, zug, qtr);
+                                                             vertexOffset, faceOffset, xug, yug, zug, qtr, bvh, locator);
 
-    // No QuadTreeRectangle in cache. So get shared pointer for one created
+    // No locator in cache. So get shared pointer for one created
     // by UnstructuredGrid2D() and cache it for later use. The memory
     // will be garbage collected when all pointers to it go out of scope
     //
-    if (!qtr) {
-        qtr = g->GetQuadTreeRectangle();
-        (void)_qtrCache.put(qtr_key, qtr);
+    if (!inMemory && locator == UnstructuredGrid::BVH) {
+        if (!bvh && !fingerprint.empty()) (void)_locatorCache.PutBVHRectangle(fingerprint, *g->GetBVHRectangle());
+        _putBVHRectangle(qtr_key, g->GetBVHRectangle());
+    } else if (!inMemory) {
+        if (!qtr && !fingerprint.empty()) (void)_locatorCache.PutQuadTreeRectangle(fingerprint, *g->GetQuadTreeRectangle());
+        _putQuadTreeRectangle(qtr_key, g->GetQuadTreeRectangle());
     }
 
     return (g);
@@ -625,20 +774,31 @@ void GridHelper::_makeGridHelper(const DC::DataVar &var, const DimsType &roi_dim
 //	bsvec: data block dimensions, and coordinate block dimensions
 //  bminvec: ROI offsets in blocks, full domain, data and coordinates
 //  bmaxvec: ROI offsets in blocks, full domain, data and coordinates
+//  rbminvec: offsets in blocks of the regions stored in blkvec. Each
+//  region must enclose the ROI given by bminvec and bmaxvec
+//  rbmaxvec: offsets in blocks of the regions stored in blkvec
 //
 
 StructuredGrid *GridHelper::MakeGridStructured(string gridType, size_t ts, int level, int lod, const DC::DataVar &var, const vector<DC::CoordVar> &cvarsinfo, const DimsType &roi_dims,
-                                               const DimsType &dims, const vector<float *> &blkvec, const vector<DimsType> &bsvec, const vector<DimsType> &bminvec, const vector<DimsType> &bmaxvec)
+                                               const DimsType &dims, const vector<float *> &blkvec, const vector<DimsType> &bsvec, const vector<DimsType> &bminvec, const vector<DimsType> &bmaxvec,
+                                               const vector<DimsType> &rbminvec, const vector<DimsType> &rbmaxvec)
 {
+    VAssert(blkvec.size() == bsvec.size());
+    VAssert(blkvec.size() == rbminvec.size());
+    VAssert(blkvec.size() == rbmaxvec.size());
+
+    vector<vector<float *>> blkptrsvec;
+    for (int i = 0; i < blkvec.size(); i++) { blkptrsvec.push_back(get_blk_ptrs(blkvec[i], bsvec[i], bminvec[i], bmaxvec[i], rbminvec[i], rbmaxvec[i])); }
+
     StructuredGrid *rg = NULL;
     if (gridType == RegularGrid::GetClassType()) {
-        rg = _make_grid_regular(roi_dims, blkvec, bsvec[0], bminvec[0], bmaxvec[0]);
+        rg = _make_grid_regular(roi_dims, blkptrsvec, bsvec[0]);
     } else if (gridType == StretchedGrid::GetClassType()) {
-        rg = _make_grid_stretched(roi_dims, blkvec, bsvec[0], bminvec[0], bmaxvec[0]);
+        rg = _make_grid_stretched(roi_dims, blkptrsvec, bsvec[0]);
     } else if (gridType == LayeredGrid::GetClassType()) {
-        rg = _make_grid_layered(roi_dims, blkvec, bsvec[0], bminvec[0], bmaxvec[0]);
+        rg = _make_grid_layered(roi_dims, blkptrsvec, bsvec[0]);
     } else if (gridType == CurvilinearGrid::GetClassType()) {
-        rg = _make_grid_curvilinear(ts, level, lod, cvarsinfo, roi_dims, blkvec, bsvec[0], bminvec[0], bmaxvec[0]);
+        rg = _make_grid_curvilinear(ts, level, lod, cvarsinfo, roi_dims, blkptrsvec, bsvec[0], bminvec[0], bmaxvec[0]);
     } else {
         return (NULL);
     }
@@ -677,6 +837,7 @@ UnstructuredGrid *GridHelper::MakeGridUnstructured(string gridType, size_t ts, i
 GridHelper::~GridHelper()
 {
     while ((_qtrCache.remove_lru()) != NULL) {}
+    while ((_bvhCache.remove_lru()) != NULL) {}
 }
 
 string GridHelper::GetGridType(const DC::Mesh &m, const vector<DC::CoordVar> &cvarsinfo, const vector<vector<string>> &cdimnames) const
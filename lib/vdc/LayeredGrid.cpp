@@ -12,6 +12,32 @@
 using namespace std;
 using namespace VAPoR;
 
+namespace {
+
+// Copy the column of values of rg at (i,j) into z, reading block storage
+// directly. Indices are clamped as AccessIJK() would
+//
+void readColumn(const RegularGrid &rg, size_t i, size_t j, vector<float> &z)
+{
+    const DimsType &dims = rg.GetDimensions();
+    DimsType        bs = {1, 1, 1};
+    DimsType        bdims = {1, 1, 1};
+    Grid::CopyToArr3(rg.GetBlockSize(), bs);
+    Grid::CopyToArr3(rg.GetDimensionInBlks(), bdims);
+
+    i = std::min(i, dims[0] - 1);
+    j = std::min(j, dims[1] - 1);
+
+    const vector<float *> &blks = rg.GetBlks();
+    z.resize(dims[2]);
+    for (size_t k = 0; k < dims[2]; k++) {
+        const float *blk = blks[(k / bs[2]) * bdims[0] * bdims[1] + (j / bs[1]) * bdims[0] + (i / bs[0])];
+        z[k] = blk[((k % bs[2]) * bs[1] + (j % bs[1])) * bs[0] + (i % bs[0])];
+    }
+}
+
+};    // namespace
+
 void LayeredGrid::_layeredGrid(const DimsType &dims, const DimsType &bs, const vector<float *> &blks, const std::vector<double> &xcoords, const std::vector<double> &ycoords, const RegularGrid &zrg)
 {
     VAssert(GetDimensions().size() == 3);
@@ -119,7 +145,7 @@ void LayeredGrid::GetBoundingBox(const DimsType &min, const DimsType &max, Coord
     maxu[2] = maxcoord;
 }
 
-bool LayeredGrid::_insideGrid(const CoordType &coords, DimsType &indices, double wgts[3]) const
+bool LayeredGrid::_insideGrid(const CoordType &coords, DimsType &indices, double wgts[3], zColumns_t *columns) const
 {
     // Get indices and weights for horizontal slice
     //
@@ -162,16 +188,34 @@ bool LayeredGrid::_insideGrid(const CoordType &coords, DimsType &indices, double
 
     // Find k index of cell containing z. Already know i and j indices
     //
-    vector<double> zcoords;
+    vector<double> localZcoords;
+    vector<double> &zcoords = columns ? columns->zcoords : localZcoords;
 
     size_t nz = GetDimensions()[2];
+    zcoords.clear();
     zcoords.reserve(nz);
-    for (int kk = 0; kk < nz; kk++) {
-        // Interpolate Z coordinate across triangle
-        //
-        float zk = _zrg.AccessIJK(iv[0], jv[0], kk) * lambda[0] + _zrg.AccessIJK(iv[1], jv[1], kk) * lambda[1] + _zrg.AccessIJK(iv[2], jv[2], kk) * lambda[2];
+    if (columns) {
+        if (columns->z[0].size() != nz || columns->i != indices[0] || columns->j != indices[1]) {
+            for (int c = 0; c < 4; c++) readColumn(_zrg, indices[0] + (c & 1), indices[1] + (c >> 1), columns->z[c]);
+            columns->i = indices[0];
+            columns->j = indices[1];
+        }
+
+        const float *z0 = columns->z[(iv[0] - indices[0]) + 2 * (jv[0] - indices[1])].data();
+        const float *z1 = columns->z[(iv[1] - indices[0]) + 2 * (jv[1] - indices[1])].data();
+        const float *z2 = columns->z[(iv[2] - indices[0]) + 2 * (jv[2] - indices[1])].data();
+        for (size_t kk = 0; kk < nz; kk++) {
+            float zk = z0[kk] * lambda[0] + z1[kk] * lambda[1] + z2[kk] * lambda[2];
+            zcoords.push_back(zk);
+        }
+    } else {
+        for (int kk = 0; kk < nz; kk++) {
+            // Interpolate Z coordinate across triangle
+            //
+            float zk = _zrg.AccessIJK(iv[0], jv[0], kk) * lambda[0] + _zrg.AccessIJK(iv[1], jv[1], kk) * lambda[1] + _zrg.AccessIJK(iv[2], jv[2], kk) * lambda[2];
 
-        zcoords.push_back(zk);
+            zcoords.push_back(zk);
+        }
     }
 
     if (!Wasp::BinarySearchRange(zcoords, coords[2], indices[2])) return (false);
@@ -233,6 +277,34 @@ float LayeredGrid::GetValue(const CoordType &coords) const
     return _getValueQuadratic(cCoords.data());
 }
 
+void LayeredGrid::GetValues(const double *xyz, size_t n, float *values) const
+{
+    // Same choice of interpolation order as GetValue()
+    //
+    int interp_order = _interpolationOrder;
+    if (interp_order == 2 && GetDimensions()[2] < 3) interp_order = 1;
+    if (interp_order != 1) {
+        Grid::GetValues(xyz, n, values);
+        return;
+    }
+
+    float      mv = GetMissingValue();
+    zColumns_t columns;
+    for (size_t p = 0; p < n; p++) {
+        CoordType cCoords;
+        ClampCoord({xyz[3 * p], xyz[3 * p + 1], xyz[3 * p + 2]}, cCoords);
+
+        DimsType indices;
+        double   wgts[3];
+        if (!_insideGrid(cCoords, indices, wgts, &columns)) {
+            values[p] = mv;
+            continue;
+        }
+
+        values[p] = TrilinearInterpolateBlocked(indices[0], indices[1], indices[2], wgts[0], wgts[1], wgts[2]);
+    }
+}
+
 void LayeredGrid::SetInterpolationOrder(int order)
 {
     if (order < 0 || order > 3) order = 2;
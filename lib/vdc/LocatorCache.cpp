@@ -0,0 +1,270 @@
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <atomic>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#ifdef WIN32
+    #include <process.h>
+#else
+    #include <unistd.h>
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+#endif
+
+#include <vapor/FileUtils.h>
+#include <vapor/utils.h>
+#include <vapor/LocatorCache.h>
+
+using namespace Wasp;
+using namespace VAPoR;
+
+namespace {
+
+std::atomic<size_t> tmpCount(0);
+
+int processID()
+{
+#ifdef WIN32
+    return (_getpid());
+#else
+    return (getpid());
+#endif
+}
+
+// Every file starts with a header. 'size' is the number of bytes that
+// follow the header
+//
+struct header_t {
+    char     magic[8];
+    uint32_t version;
+    uint32_t kind;
+    uint64_t size;
+};
+
+const char     magic[8] = {'V', 'A', 'P', 'O', 'R', 'L', 'O', 'C'};
+const uint32_t version = 1;
+
+enum { QUADTREE = 1, BVH = 2 };
+
+bool validHeader(const header_t &header, uint32_t kind) { return (memcmp(header.magic, magic, sizeof(magic)) == 0 && header.version == version && header.kind == kind); }
+
+// Map the file at path and, if its header matches kind and size, pass the
+// data following the header to reader
+//
+template<class F> bool readMapped(const string &path, uint32_t kind, F reader)
+{
+#ifdef WIN32
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return (false);
+
+    header_t header;
+    in.read((char *)&header, sizeof(header));
+    if ((size_t)in.gcount() != sizeof(header) || !validHeader(header, kind)) return (false);
+
+    vector<unsigned char> buf(header.size);
+    in.read((char *)buf.data(), header.size);
+    if ((size_t)in.gcount() != header.size) return (false);
+
+    return (reader(buf.data(), buf.size()));
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return (false);
+
+    struct stat st;
+    if (fstat(fd, &st) < 0 || (size_t)st.st_size < sizeof(header_t)) {
+        close(fd);
+        return (false);
+    }
+
+    size_t nbytes = st.st_size;
+    void * addr = mmap(NULL, nbytes, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) return (false);
+
+    (void)madvise(addr, nbytes, MADV_SEQUENTIAL);
+
+    header_t header;
+    memcpy(&header, addr, sizeof(header));
+
+    bool ok = false;
+    if (validHeader(header, kind) && header.size == nbytes - sizeof(header)) { ok = reader((const unsigned char *)addr + sizeof(header), header.size); }
+
+    munmap(addr, nbytes);
+    return (ok);
+#endif
+}
+
+// One round of a 64 bit multiplicative hash, after xxHash
+//
+inline uint64_t hashRound(uint64_t acc, uint64_t word)
+{
+    acc += word * 0xC2B2AE3D27D4EB4FULL;
+    acc = (acc << 31) | (acc >> 33);
+    return (acc * 0x9E3779B185EBCA87ULL);
+}
+
+inline uint64_t hashFinal(uint64_t h)
+{
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDULL;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ULL;
+    h ^= h >> 33;
+    return (h);
+}
+
+};    // namespace
+
+LocatorCache::LocatorCache() {}
+
+int LocatorCache::Initialize(string dir)
+{
+    std::unique_lock<std::mutex> guard(_mutex);
+
+    if (!dir.empty() && !FileUtils::IsDirectory(dir)) {
+        SetErrMsg("Locator cache directory \"%s\" does not exist", dir.c_str());
+        _dir.clear();
+        return (-1);
+    }
+
+    _dir = dir;
+    return (0);
+}
+
+bool LocatorCache::Enabled() const
+{
+    std::unique_lock<std::mutex> guard(_mutex);
+    return (!_dir.empty());
+}
+
+string LocatorCache::Fingerprint(const vector<std::pair<const void *, size_t>> &buffers)
+{
+    // Two independently seeded lanes give a 128 bit hash. Each buffer is
+    // consumed 8 bytes at a time, with its length mixed in so that
+    // moving bytes between adjacent buffers changes the hash
+    //
+    uint64_t h0 = 0x243F6A8885A308D3ULL;
+    uint64_t h1 = 0x13198A2E03707344ULL;
+    uint64_t total = 0;
+
+    for (const auto &b : buffers) {
+        const unsigned char *ptr = (const unsigned char *)b.first;
+        size_t               n = b.second;
+
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            uint64_t word;
+            memcpy(&word, ptr + i, sizeof(word));
+            h0 = hashRound(h0, word);
+            h1 = hashRound(h1, word);
+        }
+        if (i < n) {
+            uint64_t word = 0;
+            memcpy(&word, ptr + i, n - i);
+            h0 = hashRound(h0, word);
+            h1 = hashRound(h1, word);
+        }
+        h0 = hashRound(h0, n);
+        h1 = hashRound(h1, ~(uint64_t)n);
+        total += n;
+    }
+
+    h0 = hashFinal(h0 ^ total);
+    h1 = hashFinal(h1 ^ (total * 0x9E3779B185EBCA87ULL));
+
+    ostringstream oss;
+    oss << std::hex << std::setfill('0') << std::setw(16) << h0 << std::setw(16) << h1;
+    return (oss.str());
+}
+
+std::shared_ptr<QuadTreeRectangleP> LocatorCache::GetQuadTreeRectangle(const string &key) const
+{
+    string path = _path(key, ".qtr");
+    if (path.empty()) return (nullptr);
+
+    std::shared_ptr<QuadTreeRectangleP> qtr = std::make_shared<QuadTreeRectangleP>(12, 0);
+
+    bool ok = readMapped(path, QUADTREE, [&qtr](const unsigned char *buf, size_t nbytes) { return (qtr->Deserialize(buf, nbytes)); });
+
+    return (ok ? qtr : nullptr);
+}
+
+bool LocatorCache::PutQuadTreeRectangle(const string &key, const QuadTreeRectangleP &qtr) const
+{
+    string path = _path(key, ".qtr");
+    if (path.empty()) return (false);
+
+    vector<unsigned char> buf;
+    qtr.Serialize(buf);
+
+    return (_write(path, QUADTREE, buf.size(), [&buf](FILE *fp) { return (fwrite(buf.data(), 1, buf.size(), fp) == buf.size()); }));
+}
+
+std::shared_ptr<BVHRectangle> LocatorCache::GetBVHRectangle(const string &key) const
+{
+    string path = _path(key, ".bvh");
+    if (path.empty()) return (nullptr);
+
+    std::shared_ptr<BVHRectangle> bvh = std::make_shared<BVHRectangle>();
+
+    bool ok = readMapped(path, BVH, [&bvh](const unsigned char *buf, size_t nbytes) { return (bvh->Deserialize(buf, nbytes)); });
+
+    return (ok ? bvh : nullptr);
+}
+
+bool LocatorCache::PutBVHRectangle(const string &key, const BVHRectangle &bvh) const
+{
+    string path = _path(key, ".bvh");
+    if (path.empty()) return (false);
+
+    vector<unsigned char> buf;
+    bvh.Serialize(buf);
+
+    return (_write(path, BVH, buf.size(), [&buf](FILE *fp) { return (fwrite(buf.data(), 1, buf.size(), fp) == buf.size()); }));
+}
+
+string LocatorCache::_path(const string &key, const string &ext) const
+{
+    std::unique_lock<std::mutex> guard(_mutex);
+
+    if (_dir.empty()) return ("");
+    return (FileUtils::JoinPaths({_dir, "vapor_locator_" + key + ext}));
+}
+
+template<class F> bool LocatorCache::_write(const string &path, uint32_t kind, uint64_t size, F writer) const
+{
+    // Write to a name unique to this process and thread, then rename, so
+    // that readers only ever see complete files
+    //
+    ostringstream oss;
+    oss << path << "." << processID() << "_" << tmpCount++ << ".tmp";
+    string tmpPath = oss.str();
+
+    FILE *fp = fopen(tmpPath.c_str(), "wb");
+    if (!fp) {
+        SetDiagMsg("LocatorCache::_write() : failed to open %s", tmpPath.c_str());
+        return (false);
+    }
+
+    header_t header;
+    memcpy(header.magic, magic, sizeof(magic));
+    header.version = version;
+    header.kind = kind;
+    header.size = size;
+
+    bool ok = fwrite(&header, sizeof(header), 1, fp) == 1 && writer(fp);
+    ok = (fclose(fp) == 0) && ok;
+
+    if (ok && std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        // Another process may have stored the same locator first
+        //
+        ok = FileUtils::IsRegularFile(path);
+    }
+    if (!ok) SetDiagMsg("LocatorCache::_write() : failed to write %s", path.c_str());
+
+    std::remove(tmpPath.c_str());
+    return (ok);
+}
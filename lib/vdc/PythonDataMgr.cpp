@@ -100,5 +100,7 @@ void PythonDataMgr::ClearCache(string varname)
 {
 //    printf("%s(%s)\n", __func__, varname.c_str());
     _free_var(varname);
+
+    std::lock_guard<std::mutex> guard(_dataVarNamesCacheMutex);
     _dataVarNamesCache.clear();
 }
@@ -2,6 +2,7 @@
 #include <vapor/VAssert.h>
 #include <vapor/utils.h>
 #include <cstdint>
+#include <cstring>
 #include <vapor/QuadTreeRectangleP.h>
 #include <vapor/OpenMPSupport.h>
 
@@ -281,6 +282,30 @@ void QuadTreeRectangleP::GetPayloadContained(float x, float y, std::vector<DimsT
     for (auto itr = p.begin(); itr != p.end(); ++itr) { payloads.push_back(DimsType{(*itr)[0], (*itr)[1], 0}); }
 }
 
+void QuadTreeRectangleP::GetPayloadIntersected(float left, float top, float right, float bottom, std::vector<DimsType> &payloads) const
+{
+    payloads.clear();
+
+    // Query every bin whose X extent overlaps the rectangle. Cells
+    // straddling a bin boundary are stored in both bins and may be
+    // returned twice.
+    //
+    float bin_width = ((float)_right - (float)_left) / ((float)_qtrs.size());
+    float binLeft = _left;
+    for (int i = 0; i < _qtrs.size(); i++) {
+        float binRight = binLeft + bin_width;
+        if (i == _qtrs.size() - 1) binRight = _right;
+
+        if (left <= binRight && right >= binLeft) {
+            std::vector<pType> p;
+            _qtrs[i]->GetPayloadIntersected(left, top, right, bottom, p);
+
+            for (auto itr = p.begin(); itr != p.end(); ++itr) { payloads.push_back(DimsType{(*itr)[0], (*itr)[1], 0}); }
+        }
+        binLeft = binRight;
+    }
+}
+
 void QuadTreeRectangleP::GetStats(std::vector<size_t> &payload_histo, std::vector<size_t> &level_histo) const
 {
     payload_histo.clear();
@@ -295,3 +320,49 @@ void QuadTreeRectangleP::GetStats(std::vector<size_t> &payload_histo, std::vecto
         level_histo.insert(level_histo.end(), l.begin(), l.end());
     }
 }
+
+void QuadTreeRectangleP::Serialize(std::vector<unsigned char> &buf) const
+{
+    uint64_t nbins = _qtrs.size();
+    float    bounds[2] = {_left, _right};
+
+    size_t offset = buf.size();
+    buf.resize(offset + sizeof(nbins) + sizeof(bounds));
+    memcpy(buf.data() + offset, &nbins, sizeof(nbins));
+    memcpy(buf.data() + offset + sizeof(nbins), bounds, sizeof(bounds));
+
+    for (int i = 0; i < _qtrs.size(); i++) { _qtrs[i]->Serialize(buf); }
+}
+
+bool QuadTreeRectangleP::Deserialize(const unsigned char *buf, size_t nbytes)
+{
+    const unsigned char *ptr = buf;
+    const unsigned char *end = buf + nbytes;
+
+    uint64_t nbins;
+    float    bounds[2];
+    if (nbytes < sizeof(nbins) + sizeof(bounds)) return (false);
+    memcpy(&nbins, ptr, sizeof(nbins));
+    memcpy(bounds, ptr + sizeof(nbins), sizeof(bounds));
+    ptr += sizeof(nbins) + sizeof(bounds);
+
+    if (nbins == 0 || nbins > nbytes) return (false);
+
+    vector<QuadTreeRectangle<float, pType> *> qtrs;
+    for (uint64_t i = 0; i < nbins; i++) {
+        QuadTreeRectangle<float, pType> *qtr = new QuadTreeRectangle<float, pType>(12, 0);
+        qtrs.push_back(qtr);
+        if (!qtr->Deserialize(ptr, end)) {
+            for (auto q : qtrs) delete q;
+            return (false);
+        }
+    }
+
+    for (int i = 0; i < _qtrs.size(); i++) {
+        if (_qtrs[i]) delete _qtrs[i];
+    }
+    _qtrs = qtrs;
+    _left = bounds[0];
+    _right = bounds[1];
+    return (true);
+}
@@ -1,5 +1,6 @@
 #include <iostream>
 #include <vector>
+#include <algorithm>
 #include "vapor/VAssert.h"
 #include <cmath>
 #include <time.h>
@@ -157,6 +158,78 @@ float RegularGrid::GetValueLinear(const CoordType &coords) const
     return (TrilinearInterpolate(i, j, k, xwgt, ywgt, zwgt));
 }
 
+void RegularGrid::GetValues(const double *xyz, size_t n, float *values) const
+{
+    if (GetInterpolationOrder() == 0) {
+        Grid::GetValues(xyz, n, values);
+        return;
+    }
+
+    size_t gdim = GetGeometryDim();
+    float  mv = GetMissingValue();
+
+    const vector<bool> &periodic = GetPeriodic();
+    bool                clamp = std::any_of(periodic.begin(), periodic.begin() + std::min(gdim, periodic.size()), [](bool v) { return (v); });
+
+    // Points are processed in packets. The inside test, and the cell
+    // indices and weights, are computed for all of a packet's points one
+    // axis at a time in loops free of calls and data dependent branches,
+    // so that the compiler can vectorize them
+    //
+    const size_t packetSize = 64;
+    double       c[3][packetSize];
+    size_t       index[3][packetSize];
+    double       wgt[3][packetSize];
+    bool         inside[packetSize];
+
+    for (size_t p0 = 0; p0 < n; p0 += packetSize) {
+        size_t np = std::min(packetSize, n - p0);
+
+        for (size_t p = 0; p < np; p++) {
+            const double *pt = xyz + 3 * (p0 + p);
+            CoordType     cCoords = {pt[0], pt[1], pt[2]};
+            if (clamp) ClampCoord({pt[0], pt[1], pt[2]}, cCoords);
+
+            for (int d = 0; d < 3; d++) c[d][p] = cCoords[d];
+            inside[p] = true;
+        }
+
+        for (size_t d = 0; d < gdim; d++) {
+            double minu = _minu[d];
+            double maxu = _maxu[d];
+#pragma omp simd
+            for (size_t p = 0; p < np; p++) inside[p] = inside[p] && !(c[d][p] < minu) && !(c[d][p] > maxu);
+        }
+
+        for (int d = 0; d < 3; d++) {
+            double minu = _minu[d];
+            double delta = _delta[d];
+            if (delta == 0.0) {
+                for (size_t p = 0; p < np; p++) {
+                    index[d][p] = 0;
+                    wgt[d][p] = 0.0;
+                }
+                continue;
+            }
+
+#pragma omp simd
+            for (size_t p = 0; p < np; p++) {
+                double x = inside[p] ? c[d][p] - minu : 0.0;
+                index[d][p] = (size_t)floor(x / delta);
+                wgt[d][p] = 1.0 - ((x - (index[d][p] * delta)) / delta);
+            }
+        }
+
+        for (size_t p = 0; p < np; p++) {
+            if (!inside[p]) {
+                values[p0 + p] = mv;
+                continue;
+            }
+            values[p0 + p] = TrilinearInterpolateBlocked(index[0][p], index[1][p], index[2][p], wgt[0][p], wgt[1][p], wgt[2][p]);
+        }
+    }
+}
+
 void RegularGrid::GetUserExtentsHelper(CoordType &minu, CoordType &maxu) const
 {
     minu = _minu;
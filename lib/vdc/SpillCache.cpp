@@ -0,0 +1,207 @@
+#include <cstdio>
+#include <cstring>
+#include <atomic>
+#include <fstream>
+#include <sstream>
+#ifdef WIN32
+    #include <process.h>
+#else
+    #include <unistd.h>
+    #include <fcntl.h>
+    #include <sys/mman.h>
+#endif
+
+#include <vapor/FileUtils.h>
+#include <vapor/SpillCache.h>
+
+using namespace Wasp;
+using namespace VAPoR;
+
+namespace {
+
+std::atomic<size_t> instanceCount(0);
+
+int processID()
+{
+#ifdef WIN32
+    return (_getpid());
+#else
+    return (getpid());
+#endif
+}
+
+#ifdef WIN32
+// Copy the contents of the file at path, which must be at least nbytes
+// long, into data
+//
+bool readFile(const string &path, void *data, size_t nbytes)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return (false);
+
+    in.read((char *)data, nbytes);
+    return ((size_t)in.gcount() == nbytes);
+}
+#else
+// Copy the contents of the open file fd, which must be at least nbytes
+// long, into data
+//
+bool readFile(int fd, void *data, size_t nbytes)
+{
+    void *addr = mmap(NULL, nbytes, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (addr == MAP_FAILED) return (false);
+
+    (void)madvise(addr, nbytes, MADV_SEQUENTIAL);
+    memcpy(data, addr, nbytes);
+
+    munmap(addr, nbytes);
+    return (true);
+}
+#endif
+
+};    // namespace
+
+SpillCache::SpillCache()
+{
+    ostringstream oss;
+    oss << "vapor_spill_" << processID() << "_" << instanceCount++ << "_";
+    _prefix = oss.str();
+
+    _maxBytes = 0;
+    _size = 0;
+    _nextFile = 0;
+}
+
+SpillCache::~SpillCache() { Clear(); }
+
+int SpillCache::Initialize(string dir, size_t maxBytes)
+{
+    Clear();
+
+    std::unique_lock<std::mutex> guard(_mutex);
+
+    if (!dir.empty() && !FileUtils::IsDirectory(dir)) {
+        SetErrMsg("Spill cache directory \"%s\" does not exist", dir.c_str());
+        _dir.clear();
+        return (-1);
+    }
+
+    _dir = dir;
+    _maxBytes = maxBytes;
+    return (0);
+}
+
+bool SpillCache::Enabled() const
+{
+    std::unique_lock<std::mutex> guard(_mutex);
+    return (!_dir.empty());
+}
+
+bool SpillCache::Put(const string &key, const string &tag, const void *data, size_t nbytes)
+{
+    std::unique_lock<std::mutex> guard(_mutex);
+
+    if (_dir.empty() || nbytes > _maxBytes) return (false);
+
+    auto idx = _index.find(key);
+    if (idx != _index.end()) {
+        _lru.splice(_lru.end(), _lru, idx->second);
+        return (true);
+    }
+
+    entry_t entry;
+    entry.key = key;
+    entry.tag = tag;
+    entry.path = FileUtils::JoinPaths({_dir, _prefix + std::to_string(_nextFile++) + ".blk"});
+    entry.nbytes = nbytes;
+
+    // The file name is unique, so the file is written without holding
+    // the lock, and other threads may Get() meanwhile
+    //
+    guard.unlock();
+
+    std::ofstream out(entry.path, std::ios::binary | std::ios::trunc);
+    if (out) out.write((const char *)data, nbytes);
+    if (out) out.close();
+    if (!out) {
+        SetDiagMsg("SpillCache::Put() : failed to write %s", entry.path.c_str());
+        out.close();
+        std::remove(entry.path.c_str());
+        return (false);
+    }
+
+    guard.lock();
+
+    // Another thread may have stored the same block, or the cache may
+    // have been cleared or disabled, in the meantime
+    //
+    if (_index.find(key) != _index.end() || _dir.empty() || nbytes > _maxBytes) {
+        std::remove(entry.path.c_str());
+        return (_index.find(key) != _index.end());
+    }
+
+    // Make room
+    //
+    while (_size + nbytes > _maxBytes && !_lru.empty()) _erase(_lru.begin());
+
+    _index[key] = _lru.insert(_lru.end(), entry);
+    _size += nbytes;
+    return (true);
+}
+
+bool SpillCache::Get(const string &key, void *data, size_t nbytes)
+{
+    std::unique_lock<std::mutex> guard(_mutex);
+
+    auto idx = _index.find(key);
+    if (idx == _index.end() || idx->second->nbytes != nbytes) return (false);
+
+    _lru.splice(_lru.end(), _lru, idx->second);
+
+#ifdef WIN32
+    return (readFile(idx->second->path, data, nbytes));
+#else
+    // Once opened the file remains readable even if another thread
+    // removes it, so the copy is made without holding the lock
+    //
+    int fd = open(idx->second->path.c_str(), O_RDONLY);
+    guard.unlock();
+    if (fd < 0) return (false);
+
+    bool ok = readFile(fd, data, nbytes);
+    close(fd);
+    return (ok);
+#endif
+}
+
+void SpillCache::Purge(const string &tag)
+{
+    std::unique_lock<std::mutex> guard(_mutex);
+
+    for (auto itr = _lru.begin(); itr != _lru.end();) {
+        auto next = std::next(itr);
+        if (itr->tag == tag) _erase(itr);
+        itr = next;
+    }
+}
+
+void SpillCache::Clear()
+{
+    std::unique_lock<std::mutex> guard(_mutex);
+
+    while (!_lru.empty()) _erase(_lru.begin());
+}
+
+size_t SpillCache::GetSize() const
+{
+    std::unique_lock<std::mutex> guard(_mutex);
+    return (_size);
+}
+
+void SpillCache::_erase(std::list<entry_t>::iterator itr)
+{
+    std::remove(itr->path.c_str());
+    _size -= itr->nbytes;
+    _index.erase(itr->key);
+    _lru.erase(itr);
+}
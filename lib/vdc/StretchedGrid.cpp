@@ -11,6 +11,21 @@
 using namespace std;
 using namespace VAPoR;
 
+namespace {
+
+// Same as Wasp::BinarySearchRange(), but first checks whether x lies in
+// the interval starting at the index i found for a previous point
+//
+bool searchRangeHint(const vector<double> &sorted, double x, size_t &i)
+{
+    size_t n = sorted.size();
+    if (n > 1 && i + 1 < n && sorted[0] <= sorted[n - 1] && sorted[i] <= x && x < sorted[i + 1]) return (true);
+
+    return (Wasp::BinarySearchRange(sorted, x, i));
+}
+
+};    // namespace
+
 void StretchedGrid::_stretchedGrid(const vector<double> &xcoords, const vector<double> &ycoords, const vector<double> &zcoords)
 {
     VAssert(xcoords.size() != 0);
@@ -282,6 +297,34 @@ float StretchedGrid::GetValueLinear(const CoordType &coords) const
     return (TrilinearInterpolate(i, j, k, wgts[0], wgts[1], wgts[2]));
 }
 
+void StretchedGrid::GetValues(const double *xyz, size_t n, float *values) const
+{
+    if (GetInterpolationOrder() == 0) {
+        Grid::GetValues(xyz, n, values);
+        return;
+    }
+
+    float mv = GetMissingValue();
+
+    // The cell found for each point is the starting guess for the next,
+    // so coherent points skip the coordinate searches
+    //
+    size_t i = 0, j = 0, k = 0;
+    for (size_t p = 0; p < n; p++) {
+        CoordType cCoords;
+        ClampCoord({xyz[3 * p], xyz[3 * p + 1], xyz[3 * p + 2]}, cCoords);
+
+        double wgts[] = {0.0, 0.0, 0.0};
+        double z = GetGeometryDim() == 3 ? cCoords[2] : 0.0;
+        if (!_insideGrid(cCoords[0], cCoords[1], z, i, j, k, wgts[0], wgts[1], wgts[2], true)) {
+            values[p] = mv;
+            continue;
+        }
+
+        values[p] = TrilinearInterpolateBlocked(i, j, k, wgts[0], wgts[1], wgts[2]);
+    }
+}
+
 void StretchedGrid::GetUserExtentsHelper(CoordType &minext, CoordType &maxext) const
 {
     auto dims = StructuredGrid::GetDimensions();
@@ -307,14 +350,16 @@ void StretchedGrid::GetUserExtentsHelper(CoordType &minext, CoordType &maxext) c
 // If the point is outside of the
 // grid the values of 'xwgt', 'ywgt', and 'zwgt' are not defined
 //
-bool StretchedGrid::_insideGrid(double x, double y, double z, size_t &i, size_t &j, size_t &k, double &xwgt, double &ywgt, double &zwgt) const
+bool StretchedGrid::_insideGrid(double x, double y, double z, size_t &i, size_t &j, size_t &k, double &xwgt, double &ywgt, double &zwgt, bool hint) const
 {
     xwgt = 0.0;
     ywgt = 0.0;
     zwgt = 0.0;
-    i = j = k = 0;
+    if (!hint) i = j = k = 0;
+
+    auto search = hint ? searchRangeHint : Wasp::BinarySearchRange;
 
-    if (!Wasp::BinarySearchRange(_xcoords, x, i)) return (false);
+    if (!search(_xcoords, x, i)) return (false);
 
     if (_xcoords.size() > 1) {
         xwgt = 1.0 - (x - _xcoords[i]) / (_xcoords[i + 1] - _xcoords[i]);
@@ -323,7 +368,7 @@ bool StretchedGrid::_insideGrid(double x, double y, double z, size_t &i, size_t
     }
 
 
-    if (!Wasp::BinarySearchRange(_ycoords, y, j)) return (false);
+    if (!search(_ycoords, y, j)) return (false);
 
     if (_ycoords.size() > 1) {
         ywgt = 1.0 - (y - _ycoords[j]) / (_ycoords[j + 1] - _ycoords[j]);
@@ -339,7 +384,7 @@ bool StretchedGrid::_insideGrid(double x, double y, double z, size_t &i, size_t
     // Now verify that Z coordinate of point is in grid, and find
     // its interpolation weights if so.
     //
-    if (!Wasp::BinarySearchRange(_zcoords, z, k)) return (false);
+    if (!search(_zcoords, z, k)) return (false);
 
     if (_zcoords.size() > 1) {
         zwgt = 1.0 - (z - _zcoords[k]) / (_zcoords[k + 1] - _zcoords[k]);
@@ -23,9 +23,9 @@ UnstructuredGrid2D::UnstructuredGrid2D(const DimsType &vertexDims, const DimsTyp
                                        const int *faceOnVertex, const int *faceOnFace,
                                        Location location,    // node,face, edge
                                        size_t maxVertexPerFace, size_t maxFacePerVertex, long nodeOffset, long cellOffset, const UnstructuredGridCoordless &xug, const UnstructuredGridCoordless &yug,
-                                       const UnstructuredGridCoordless &zug, std::shared_ptr<const QuadTreeRectangleP> qtr)
+                                       const UnstructuredGridCoordless &zug, std::shared_ptr<const QuadTreeRectangleP> qtr, std::shared_ptr<const BVHRectangle> bvh, CellLocator locator)
 : UnstructuredGrid(vertexDims, faceDims, edgeDims, bs, blks, 2, vertexOnFace, faceOnVertex, faceOnFace, location, maxVertexPerFace, maxFacePerVertex, nodeOffset, cellOffset), _xug(xug), _yug(yug),
-  _zug(zug), _qtr(qtr)
+  _zug(zug), _qtr(qtr), _bvh(bvh)
 {
     VAssert(xug.GetDimensions() == GetDimensions());
     VAssert(yug.GetDimensions() == GetDimensions());
@@ -33,16 +33,20 @@ UnstructuredGrid2D::UnstructuredGrid2D(const DimsType &vertexDims, const DimsTyp
 
     VAssert(location == NODE);
 
-    if (!_qtr) { _qtr = _makeQuadTreeRectangle(); }
+    if (locator == BVH) {
+        if (!_bvh) { _bvh = MakeBVHRectangle(); }
+    } else if (!_qtr) {
+        _qtr = _makeQuadTreeRectangle();
+    }
 }
 
 UnstructuredGrid2D::UnstructuredGrid2D(const std::vector<size_t> &vertexDims, const std::vector<size_t> &faceDims, const std::vector<size_t> &edgeDims, const std::vector<size_t> &bs,
                                        const std::vector<float *> &blks, const int *vertexOnFace, const int *faceOnVertex, const int *faceOnFace,
                                        Location location,    // node,face, edge
                                        size_t maxVertexPerFace, size_t maxFacePerVertex, long nodeOffset, long cellOffset, const UnstructuredGridCoordless &xug, const UnstructuredGridCoordless &yug,
-                                       const UnstructuredGridCoordless &zug, std::shared_ptr<const QuadTreeRectangleP> qtr)
+                                       const UnstructuredGridCoordless &zug, std::shared_ptr<const QuadTreeRectangleP> qtr, std::shared_ptr<const BVHRectangle> bvh, CellLocator locator)
 : UnstructuredGrid(vertexDims, faceDims, edgeDims, bs, blks, 2, vertexOnFace, faceOnVertex, faceOnFace, location, maxVertexPerFace, maxFacePerVertex, nodeOffset, cellOffset), _xug(xug), _yug(yug),
-  _zug(zug), _qtr(qtr)
+  _zug(zug), _qtr(qtr), _bvh(bvh)
 {
     VAssert(xug.GetDimensions() == GetDimensions());
     VAssert(yug.GetDimensions() == GetDimensions());
@@ -50,7 +54,11 @@ UnstructuredGrid2D::UnstructuredGrid2D(const std::vector<size_t> &vertexDims, co
 
     VAssert(location == NODE);
 
-    if (!_qtr) { _qtr = _makeQuadTreeRectangle(); }
+    if (locator == BVH) {
+        if (!_bvh) { _bvh = MakeBVHRectangle(); }
+    } else if (!_qtr) {
+        _qtr = _makeQuadTreeRectangle();
+    }
 }
 
 DimsType UnstructuredGrid2D::GetCoordDimensions(size_t dim) const
@@ -362,7 +370,11 @@ bool UnstructuredGrid2D::_insideGridNodeCentered(const CoordType &coords, size_t
     // Find the indices for the faces that might contain the point
     //
     vector<DimsType> face_indices;
-    _qtr->GetPayloadContained(pt[0], pt[1], face_indices);
+    if (_bvh) {
+        _bvh->GetPayloadContained(pt[0], pt[1], face_indices);
+    } else {
+        _qtr->GetPayloadContained(pt[0], pt[1], face_indices);
+    }
 
     for (int i = 0; i < face_indices.size(); i++) {
         if (_insideFace(face_indices[i][0], pt, nodes, lambda, nlambda)) {
@@ -429,3 +441,11 @@ std::shared_ptr<QuadTreeRectangleP> UnstructuredGrid2D::_makeQuadTreeRectangle()
     qtr->Insert(this);
     return (qtr);
 }
+
+std::shared_ptr<BVHRectangle> UnstructuredGrid2D::MakeBVHRectangle() const
+{
+    std::shared_ptr<BVHRectangle> bvh = std::make_shared<BVHRectangle>();
+
+    bvh->Build(this);
+    return (bvh);
+}
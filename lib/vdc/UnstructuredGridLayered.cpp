@@ -23,10 +23,11 @@ UnstructuredGridLayered::UnstructuredGridLayered(const DimsType &vertexDims, con
                                                  const int *vertexOnFace, const int *faceOnVertex, const int *faceOnFace,
                                                  Location location,    // node,face, edge
                                                  size_t maxVertexPerFace, size_t maxFacePerVertex, long nodeOffset, long cellOffset, const UnstructuredGridCoordless &xug,
-                                                 const UnstructuredGridCoordless &yug, const UnstructuredGridCoordless &zug, std::shared_ptr<const QuadTreeRectangleP> qtr)
+                                                 const UnstructuredGridCoordless &yug, const UnstructuredGridCoordless &zug, std::shared_ptr<const QuadTreeRectangleP> qtr,
+                                                 std::shared_ptr<const BVHRectangle> bvh, CellLocator locator)
 : UnstructuredGrid(vertexDims, faceDims, edgeDims, bs, blks, 3, vertexOnFace, faceOnVertex, faceOnFace, location, maxVertexPerFace, maxFacePerVertex, nodeOffset, cellOffset),
   _ug2d(vector<size_t>{vertexDims[0]}, vector<size_t>{faceDims[0]}, edgeDims.size() ? vector<size_t>{edgeDims[0]} : vector<size_t>(), vector<size_t>{bs[0]}, vector<float *>(), vertexOnFace,
-        faceOnVertex, faceOnFace, location, maxVertexPerFace, maxFacePerVertex, nodeOffset, cellOffset, xug, yug, UnstructuredGridCoordless(), qtr),
+        faceOnVertex, faceOnFace, location, maxVertexPerFace, maxFacePerVertex, nodeOffset, cellOffset, xug, yug, UnstructuredGridCoordless(), qtr, bvh, locator),
   _zug(zug)
 {
     VAssert(xug.GetNumDimensions() == 1);
@@ -40,10 +41,11 @@ UnstructuredGridLayered::UnstructuredGridLayered(const std::vector<size_t> &vert
                                                  const std::vector<float *> &blks, const int *vertexOnFace, const int *faceOnVertex, const int *faceOnFace,
                                                  Location location,    // node,face, edge
                                                  size_t maxVertexPerFace, size_t maxFacePerVertex, long nodeOffset, long cellOffset, const UnstructuredGridCoordless &xug,
-                                                 const UnstructuredGridCoordless &yug, const UnstructuredGridCoordless &zug, std::shared_ptr<const QuadTreeRectangleP> qtr)
+                                                 const UnstructuredGridCoordless &yug, const UnstructuredGridCoordless &zug, std::shared_ptr<const QuadTreeRectangleP> qtr,
+                                                 std::shared_ptr<const BVHRectangle> bvh, CellLocator locator)
 : UnstructuredGrid(vertexDims, faceDims, edgeDims, bs, blks, 3, vertexOnFace, faceOnVertex, faceOnFace, location, maxVertexPerFace, maxFacePerVertex, nodeOffset, cellOffset),
   _ug2d(vector<size_t>{vertexDims[0]}, vector<size_t>{faceDims[0]}, edgeDims.size() ? vector<size_t>{edgeDims[0]} : vector<size_t>(), vector<size_t>{bs[0]}, vector<float *>(), vertexOnFace,
-        faceOnVertex, faceOnFace, location, maxVertexPerFace, maxFacePerVertex, nodeOffset, cellOffset, xug, yug, UnstructuredGridCoordless(), qtr),
+        faceOnVertex, faceOnFace, location, maxVertexPerFace, maxFacePerVertex, nodeOffset, cellOffset, xug, yug, UnstructuredGridCoordless(), qtr, bvh, locator),
   _zug(zug)
 {
     VAssert(xug.GetNumDimensions() == 1);
@@ -734,6 +734,30 @@ int VDCNetCDF::readRegion(int fd, const vector<size_t> &min, const vector<size_t
 
 int VDCNetCDF::readRegion(int fd, const vector<size_t> &min, const vector<size_t> &max, int *region) { return (_readRegionTemplate(fd, min, max, region)); }
 
+int VDCNetCDF::readRegionRange(int fd, const vector<size_t> &min, const vector<size_t> &max, vector<double> &range)
+{
+    range.clear();
+
+    VDCFileObject *o = (VDCFileObject *)_fileTable.GetEntry(fd);
+    if (!o) {
+        SetErrMsg("Invalid file descriptor : %d", fd);
+        return (-1);
+    }
+
+    // Block ranges of masked variables may include missing values
+    //
+    if (o->GetWaspMask()) return (0);
+
+    string varname = o->GetVarname();
+    size_t file_ts = o->GetFileTS();
+
+    vector<size_t> start;
+    vector<size_t> count;
+    vdc_2_ncdfcoords(file_ts, file_ts, VDC::IsTimeVarying(varname), min, max, start, count);
+
+    return (o->GetWaspData()->GetVaraRange(start, count, range));
+}
+
 
 template<class T> int VDCNetCDF::_putVarTemplate(string varname, int lod, const T *data)
 {
@@ -2595,6 +2595,64 @@ template<class T> int WASP::_GetVara(vector<size_t> start, vector<size_t> count,
     }
 }
 
+int WASP::GetVaraRange(vector<size_t> start, vector<size_t> count, vector<double> &range)
+{
+    range.clear();
+
+    if (!_waspFile) {
+        SetErrMsg("Not a WASP file");
+        return (-1);
+    }
+
+    if (!_open || _open_write) {
+        SetErrMsg("Invalid state");
+        return (-1);
+    }
+
+    // Only compressed blocks have a header recording their range
+    //
+    if (!_open_waspvar || _open_wname.empty()) return (0);
+
+    vector<size_t> dims_at_level;
+    vector<size_t> bs_at_level;
+    _dims_at_level(_open_udims, _open_bs, _open_level, _open_wname, dims_at_level, bs_at_level);
+
+    if (start.size() != dims_at_level.size() || count.size() != dims_at_level.size()) {
+        SetErrMsg("Invalid parameter");
+        return (-1);
+    }
+
+    // The number of blocks is the same at every refinement level. Find
+    // the coordinates of the blocks intersecting the hyper-slab
+    //
+    vector<size_t> bstart, bcount;
+    for (int i = 0; i < start.size(); i++) {
+        if (count[i] < 1 || start[i] + count[i] > dims_at_level[i]) {
+            SetErrMsg("Invalid parameter");
+            return (-1);
+        }
+        bstart.push_back(start[i] / bs_at_level[i]);
+        bcount.push_back(((start[i] + count[i] - 1) / bs_at_level[i]) - bstart[i] + 1);
+    }
+
+    // Block headers are stored in the base (lod 0) file, at the start of
+    // each block's coefficients
+    //
+    bstart.push_back(0);
+    bcount.push_back(BLK_HDR_SZ);
+
+    vector<double> headers(vproduct(bcount));
+    int            rc = _ncdfcptrs[0]->NetCDFCpp::GetVara(_open_varname, bstart, bcount, headers.data());
+    if (rc < 0) return (rc);
+
+    range = {headers[0], headers[1]};
+    for (size_t i = BLK_HDR_SZ; i < headers.size(); i += BLK_HDR_SZ) {
+        range[0] = std::min(range[0], headers[i]);
+        range[1] = std::max(range[1], headers[i + 1]);
+    }
+    return (1);
+}
+
 ////////////////////////////////////////////////////////////////////////////
 //
 // GetVar - float
@@ -0,0 +1,257 @@
+#include <iostream>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <string>
+#include <random>
+#include <algorithm>
+
+#include "vapor/BlkMemMgr.h"
+
+using namespace VAPoR;
+
+namespace {
+
+const size_t blkSize = 16;
+
+size_t nfailures = 0;
+
+void Check(bool ok, const std::string &what)
+{
+    if (ok) return;
+    std::printf("FAILED : %s\n", what.c_str());
+    nfailures++;
+}
+
+struct allocation_t {
+    unsigned char *ptr;
+    size_t         nblks;
+    unsigned char  tag;
+};
+
+// Fill an allocation with its tag, so that overlapping allocations are
+// detected when it is freed
+//
+void Fill(const allocation_t &a) { memset(a.ptr, a.tag, a.nblks * blkSize); }
+
+bool Intact(const allocation_t &a)
+{
+    for (size_t i = 0; i < a.nblks * blkSize; i++) {
+        if (a.ptr[i] != a.tag) return (false);
+    }
+    return (true);
+}
+
+// Check the pool statistics against the allocations we know of. Adjacent
+// free runs are always coalesced, so any two free runs are separated by
+// at least one allocation
+//
+void CheckStats(const std::vector<allocation_t> &live, size_t poolBlks, const std::string &when)
+{
+    size_t used = 0;
+    for (const auto &a : live) used += a.nblks;
+
+    BlkMemMgr::stats_t stats;
+    BlkMemMgr::GetStats(stats);
+
+    Check(stats.poolBlks == poolBlks, when + ": pool size");
+    Check(stats.usedBlks == used, when + ": used blocks");
+    Check(stats.numAllocs == live.size(), when + ": number of allocations");
+    Check(stats.freeBlks == poolBlks - used, when + ": free blocks");
+    Check(stats.freeRuns <= live.size() + 1, when + ": free runs not coalesced");
+    Check(stats.largestFreeRun <= stats.freeBlks, when + ": largest free run");
+}
+
+// Each test holds the only BlkMemMgr instance, so it starts from an empty
+// pool that is freed when it returns. Allocating the whole pool first
+// makes it a single region, in which all free runs may coalesce
+//
+bool Prime(BlkMemMgr &mgr, size_t poolBlks)
+{
+    void *ptr = mgr.Alloc(poolBlks);
+    Check(ptr != NULL, "allocate whole pool");
+    Check(mgr.Alloc(1) == NULL, "allocation beyond pool size");
+    if (ptr) mgr.FreeMem(ptr);
+    return (ptr != NULL);
+}
+
+// Fill the pool, leave holes of 4, 8, and 2 blocks separated by single
+// allocated blocks, and check that each request is served from the
+// smallest hole that fits and that freed memory is reused
+//
+void TestBestFit(size_t poolBlks)
+{
+    BlkMemMgr mgr;
+    if (!Prime(mgr, poolBlks)) return;
+
+    const size_t sizes[] = {4, 1, 8, 1, 2, 1};
+
+    std::vector<unsigned char *> ptrs;
+    size_t                       total = 0;
+    for (size_t n : sizes) {
+        ptrs.push_back((unsigned char *)mgr.Alloc(n));
+        total += n;
+    }
+    unsigned char *rest = (unsigned char *)mgr.Alloc(poolBlks - total);
+    Check(rest != NULL, "best fit: fill pool");
+    Check(mgr.Alloc(1) == NULL, "best fit: allocation from full pool");
+
+    for (size_t i = 1; i < ptrs.size(); i++) Check(ptrs[i] == ptrs[i - 1] + sizes[i - 1] * blkSize, "best fit: allocations are contiguous");
+
+    mgr.FreeMem(ptrs[0]);
+    mgr.FreeMem(ptrs[2]);
+    mgr.FreeMem(ptrs[4]);
+
+    Check(mgr.Alloc(2) == ptrs[4], "best fit: 2 blocks from the 2 block hole");
+    Check(mgr.Alloc(3) == ptrs[0], "best fit: 3 blocks from the 4 block hole");
+    Check(mgr.Alloc(1) == ptrs[0] + 3 * blkSize, "best fit: 1 block from the remainder of the 4 block hole");
+    Check(mgr.Alloc(9) == NULL, "best fit: 9 blocks when the largest hole is 8");
+    Check(mgr.Alloc(8) == ptrs[2], "best fit: 8 blocks from the 8 block hole");
+    Check(mgr.Alloc(1) == NULL, "best fit: allocation from refilled pool");
+
+    BlkMemMgr::stats_t stats;
+    BlkMemMgr::GetStats(stats);
+    Check(stats.freeBlks == 0 && stats.freeRuns == 0, "best fit: no free blocks");
+}
+
+// Free a full pool of single blocks in random order. Every free must
+// merge with its free neighbors, leaving a single run
+//
+void TestCoalesce(size_t poolBlks, std::mt19937 &gen)
+{
+    BlkMemMgr mgr;
+    if (!Prime(mgr, poolBlks)) return;
+
+    std::vector<unsigned char *> ptrs;
+    for (size_t i = 0; i < poolBlks; i++) ptrs.push_back((unsigned char *)mgr.Alloc(1));
+    Check(std::find(ptrs.begin(), ptrs.end(), (unsigned char *)NULL) == ptrs.end(), "coalesce: fill pool");
+
+    std::shuffle(ptrs.begin(), ptrs.end(), gen);
+
+    std::vector<unsigned char *> freed;
+    for (size_t i = 0; i < ptrs.size(); i++) {
+        mgr.FreeMem(ptrs[i]);
+        freed.push_back(ptrs[i]);
+
+        // The number of free runs is the number of maximal sequences of
+        // consecutive freed blocks
+        //
+        std::sort(freed.begin(), freed.end());
+        size_t runs = 1;
+        for (size_t j = 1; j < freed.size(); j++) {
+            if (freed[j] != freed[j - 1] + blkSize) runs++;
+        }
+
+        BlkMemMgr::stats_t stats;
+        BlkMemMgr::GetStats(stats);
+        if (stats.freeRuns != runs) {
+            Check(false, "coalesce: " + std::to_string(stats.freeRuns) + " free runs, expected " + std::to_string(runs));
+            break;
+        }
+    }
+
+    BlkMemMgr::stats_t stats;
+    BlkMemMgr::GetStats(stats);
+    Check(stats.freeRuns == 1 && stats.largestFreeRun == poolBlks, "coalesce: single free run");
+    Check(BlkMemMgr::GetFragmentation() == 0.0, "coalesce: fragmentation");
+    Check(mgr.Alloc(poolBlks) != NULL, "coalesce: allocate whole pool");
+}
+
+// Random sequences of allocations and frees of random sizes
+//
+void TestRandom(size_t poolBlks, size_t niters, std::mt19937 &gen)
+{
+    BlkMemMgr mgr;
+    if (!Prime(mgr, poolBlks)) return;
+
+    std::vector<allocation_t>             live;
+    std::uniform_int_distribution<size_t> sizeDist(1, std::max((size_t)1, poolBlks / 16));
+    std::uniform_int_distribution<int>    opDist(0, 99);
+    size_t                                nallocs = 0;
+    size_t                                nnull = 0;
+    unsigned char                         tag = 0;
+
+    for (size_t iter = 0; iter < niters; iter++) {
+        // Allocate more often than free, so that the pool is often full
+        //
+        if (live.empty() || opDist(gen) < 55) {
+            size_t n = sizeDist(gen);
+
+            BlkMemMgr::stats_t before;
+            BlkMemMgr::GetStats(before);
+
+            bool           fill = opDist(gen) < 10;
+            unsigned char *ptr = (unsigned char *)mgr.Alloc(n, fill);
+            if (!ptr) {
+                // Only fail if no free run is large enough
+                //
+                Check(before.largestFreeRun < n, "random: allocation of " + std::to_string(n) + " blocks failed with a free run of " + std::to_string(before.largestFreeRun));
+                nnull++;
+            } else {
+                if (fill) {
+                    bool zero = true;
+                    for (size_t i = 0; i < n * blkSize; i++) zero = zero && ptr[i] == 0;
+                    Check(zero, "random: filled allocation is not zero");
+                }
+                live.push_back({ptr, n, ++tag});
+                Fill(live.back());
+                nallocs++;
+            }
+        } else {
+            std::uniform_int_distribution<size_t> pick(0, live.size() - 1);
+            size_t                                i = pick(gen);
+
+            Check(Intact(live[i]), "random: allocation overwritten");
+            mgr.FreeMem(live[i].ptr);
+            live[i] = live.back();
+            live.pop_back();
+        }
+
+        CheckStats(live, poolBlks, "random iteration " + std::to_string(iter));
+        if (nfailures) break;
+    }
+
+    for (const auto &a : live) {
+        Check(Intact(a), "random: allocation overwritten");
+        mgr.FreeMem(a.ptr);
+    }
+    live.clear();
+    CheckStats(live, poolBlks, "random: after freeing all");
+
+    BlkMemMgr::stats_t stats;
+    BlkMemMgr::GetStats(stats);
+    Check(stats.freeRuns == 1 && stats.largestFreeRun == poolBlks, "random: single free run after freeing all");
+
+    std::printf("random : %zu allocations, %zu out of memory\n", nallocs, nnull);
+}
+
+}    // namespace
+
+int main(int argc, char *argv[])
+{
+    if (argc != 4) {
+        std::cout << "Help:  This program checks the BlkMemMgr allocator on a pool of Blocks blocks:\n"
+                     "       best fit placement, reuse of freed memory, coalescing of free runs, and\n"
+                     "       out of memory behavior, followed by Iterations random allocations and\n"
+                     "       frees seeded with Seed.\n"
+                     "Usage: ./BlkMemMgrTest Blocks Iterations Seed\n";
+        return 1;
+    }
+    const size_t poolBlks = std::stol(argv[1]);
+    const size_t niters = std::stol(argv[2]);
+    std::mt19937 gen(std::stol(argv[3]));
+
+    if (poolBlks < 32) {
+        std::printf("Blocks must be at least 32\n");
+        return 1;
+    }
+
+    BlkMemMgr::RequestMemSize(blkSize, poolBlks, false);
+
+    TestBestFit(poolBlks);
+    TestCoalesce(poolBlks, gen);
+    TestRandom(poolBlks, niters, gen);
+
+    std::printf("%zu failures%s\n", nfailures, nfailures ? " FAILED" : "");
+    return (nfailures ? 1 : 0);
+}
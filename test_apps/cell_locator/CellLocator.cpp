@@ -0,0 +1,331 @@
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <cstdio>
+#include <cmath>
+#include <vector>
+#include <memory>
+#include <random>
+#include <string>
+
+#include "vapor/DataMgr.h"
+#include "vapor/UnstructuredGrid2D.h"
+#include "vapor/QuadTreeRectangleP.h"
+#include "vapor/BVHRectangle.h"
+#include "vapor/LocatorCache.h"
+
+using namespace VAPoR;
+
+namespace {
+
+double Milliseconds(std::chrono::steady_clock::time_point t0) { return (std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count()); }
+
+// Storage for the synthetic mesh. Must outlive the grid
+//
+struct mesh_t {
+    std::vector<float> x, y, values;
+    std::vector<int>   vertexOnFace;
+    std::vector<int>   faceOnVertex;
+};
+
+// Build a triangulated n x n mesh with jittered nodes. X is stretched by
+// 'aspect', and Y is graded so that cells near the middle are much
+// smaller than those near the edges, in the manner of a variable
+// resolution MPAS mesh
+//
+UnstructuredGrid2D *SyntheticMesh(size_t n, double aspect, mesh_t &m)
+{
+    size_t nv = n * n;
+    size_t nf = 2 * (n - 1) * (n - 1);
+    size_t maxFacePerVertex = 6;
+
+    std::mt19937                           gen(7);
+    std::uniform_real_distribution<double> jitter(-0.25, 0.25);
+
+    m.x.resize(nv);
+    m.y.resize(nv);
+    m.values.resize(nv);
+    for (size_t j = 0; j < n; j++) {
+        for (size_t i = 0; i < n; i++) {
+            double s = (i + (i > 0 && i < n - 1 ? jitter(gen) : 0.0)) / (n - 1);
+            double t = (j + (j > 0 && j < n - 1 ? jitter(gen) : 0.0)) / (n - 1);
+            m.x[j * n + i] = aspect * s;
+            m.y[j * n + i] = std::sinh(8.0 * (t - 0.5)) / std::sinh(4.0);
+            m.values[j * n + i] = std::sin(10.0 * s) * std::cos(3.0 * t);
+        }
+    }
+
+    m.vertexOnFace.resize(3 * nf);
+    m.faceOnVertex.assign(maxFacePerVertex * nv, -1);
+    std::vector<size_t> nfaces(nv, 0);
+    size_t              f = 0;
+    for (size_t j = 0; j < n - 1; j++) {
+        for (size_t i = 0; i < n - 1; i++) {
+            int a = j * n + i, b = a + 1, c = a + n, d = c + 1;
+            int tris[2][3] = {{a, b, d}, {a, d, c}};
+            for (auto &tri : tris) {
+                for (int k = 0; k < 3; k++) {
+                    m.vertexOnFace[3 * f + k] = tri[k];
+                    m.faceOnVertex[maxFacePerVertex * tri[k] + nfaces[tri[k]]++] = f;
+                }
+                f++;
+            }
+        }
+    }
+
+    DimsType vertexDims = {nv, 1, 1};
+    DimsType faceDims = {nf, 1, 1};
+    DimsType edgeDims = {1, 1, 1};
+    DimsType bs = {nv, 1, 1};
+
+    UnstructuredGridCoordless xug(vertexDims, faceDims, edgeDims, bs, {m.x.data()}, 2, m.vertexOnFace.data(), m.faceOnVertex.data(), nullptr, UnstructuredGrid::NODE, 3, maxFacePerVertex, 0, 0);
+    UnstructuredGridCoordless yug(vertexDims, faceDims, edgeDims, bs, {m.y.data()}, 2, m.vertexOnFace.data(), m.faceOnVertex.data(), nullptr, UnstructuredGrid::NODE, 3, maxFacePerVertex, 0, 0);
+    UnstructuredGridCoordless zug;
+
+    return (new UnstructuredGrid2D(vertexDims, faceDims, edgeDims, bs, {m.values.data()}, m.vertexOnFace.data(), m.faceOnVertex.data(), nullptr, UnstructuredGrid::NODE, 3, maxFacePerVertex, 0, 0,
+                                   xug, yug, zug, nullptr));
+}
+
+void PrintHisto(const char *name, const std::vector<size_t> &histo)
+{
+    size_t total = 0, weighted = 0;
+    for (size_t i = 0; i < histo.size(); i++) {
+        total += histo[i];
+        weighted += i * histo[i];
+    }
+    std::printf("    %-22s max %4zu, mean %6.2f\n", name, histo.size() ? histo.size() - 1 : 0, total ? (double)weighted / total : 0.0);
+}
+
+// Return the number of points for which the two locators return different
+// candidate lists
+//
+template<class L1, class L2> int CompareCandidates(const L1 &l1, const L2 &l2, const std::vector<double> &xy)
+{
+    int                   nerrors = 0;
+    std::vector<DimsType> c1, c2;
+    for (size_t p = 0; p < xy.size() / 2; p++) {
+        l1.GetPayloadContained(xy[2 * p], xy[2 * p + 1], c1);
+        l2.GetPayloadContained(xy[2 * p], xy[2 * p + 1], c2);
+        if (c1 != c2) nerrors++;
+    }
+    return (nerrors);
+}
+
+// Store both locators in a LocatorCache in dir, load them back, and
+// check that the loaded locators return the same candidates as the
+// originals. Returns the number of mismatches
+//
+int BenchmarkCache(const std::string &dir, const QuadTreeRectangleP &qtr, const BVHRectangle &bvh, const std::vector<double> &xy)
+{
+    LocatorCache cache;
+    if (cache.Initialize(dir) < 0) {
+        std::cerr << "Invalid cache directory " << dir << std::endl;
+        return (1);
+    }
+
+    // GridHelper keys locators by the mesh coordinates. Any key will do
+    // here
+    //
+    std::string key = LocatorCache::Fingerprint({{xy.data(), xy.size() * sizeof(double)}});
+
+    auto   t0 = std::chrono::steady_clock::now();
+    bool   ok = cache.PutQuadTreeRectangle(key, qtr);
+    double qtrStore = Milliseconds(t0);
+
+    t0 = std::chrono::steady_clock::now();
+    ok &= cache.PutBVHRectangle(key, bvh);
+    double bvhStore = Milliseconds(t0);
+
+    t0 = std::chrono::steady_clock::now();
+    std::shared_ptr<QuadTreeRectangleP> qtrLoaded = cache.GetQuadTreeRectangle(key);
+    double                              qtrLoad = Milliseconds(t0);
+
+    t0 = std::chrono::steady_clock::now();
+    std::shared_ptr<BVHRectangle> bvhLoaded = cache.GetBVHRectangle(key);
+    double                        bvhLoad = Milliseconds(t0);
+
+    if (!ok || !qtrLoaded || !bvhLoaded) {
+        std::printf("  Locator cache FAILED\n\n");
+        return (1);
+    }
+
+    int nerrors = CompareCandidates(qtr, *qtrLoaded, xy) + CompareCandidates(bvh, *bvhLoaded, xy);
+
+    std::printf("  Locator cache\n");
+    std::printf("    quad tree store %10.2f ms, load %10.2f ms\n", qtrStore, qtrLoad);
+    std::printf("    BVH       store %10.2f ms, load %10.2f ms%s\n\n", bvhStore, bvhLoad, nerrors ? " MISMATCH" : "");
+
+    return (nerrors);
+}
+
+// Compare build time, candidate list lengths, and query latency of the
+// quad tree and the BVH on a grid. If cacheDir is not empty the locators
+// are also stored in, and loaded from, a LocatorCache. Returns the number
+// of points located differently by the two, or by the loaded locators
+//
+int Benchmark(UnstructuredGrid2D *g, size_t npoints, const std::string &cacheDir)
+{
+    size_t    ncells = g->GetCellDimensions()[0];
+    CoordType minu, maxu;
+    g->GetUserExtents(minu, maxu);
+    std::printf("Mesh with %zu cells, extents [%g, %g] x [%g, %g]\n\n", ncells, minu[0], maxu[0], minu[1], maxu[1]);
+
+    // Build
+    //
+    auto                                t0 = std::chrono::steady_clock::now();
+    std::shared_ptr<QuadTreeRectangleP> qtr = std::make_shared<QuadTreeRectangleP>((float)minu[0], (float)minu[1], (float)maxu[0], (float)maxu[1], 12, ncells);
+    qtr->Insert(g);
+    double qtrBuild = Milliseconds(t0);
+
+    t0 = std::chrono::steady_clock::now();
+    std::shared_ptr<BVHRectangle> bvh = g->MakeBVHRectangle();
+    double bvhBuild = Milliseconds(t0);
+
+    std::printf("  Build\n");
+    std::printf("    quad tree %10.2f ms\n", qtrBuild);
+    std::printf("    BVH       %10.2f ms (%zu nodes)\n\n", bvhBuild, bvh->GetNumNodes());
+
+    std::vector<size_t> payloadHisto, levelHisto;
+    std::printf("  Structure\n");
+    qtr->GetStats(payloadHisto, levelHisto);
+    PrintHisto("quad tree payloads", payloadHisto);
+    PrintHisto("quad tree levels", levelHisto);
+    bvh->GetStats(payloadHisto, levelHisto);
+    PrintHisto("BVH leaf sizes", payloadHisto);
+    PrintHisto("BVH leaf depths", levelHisto);
+    std::printf("\n");
+
+    // Query points uniformly distributed in index space, i.e. following
+    // the mesh resolution, as particles or slices through refined
+    // regions would
+    //
+    std::mt19937                          gen(42);
+    std::uniform_int_distribution<size_t> cellDist(0, ncells - 1);
+    std::vector<double>                   xy;
+    std::vector<DimsType>                 nodes;
+    for (size_t p = 0; p < npoints; p++) {
+        g->GetCellNodes(DimsType{cellDist(gen), 0, 0}, nodes);
+        double x = 0.0, y = 0.0;
+        for (const auto &node : nodes) {
+            CoordType c;
+            g->GetUserCoordinates(node, c);
+            x += c[0] / nodes.size();
+            y += c[1] / nodes.size();
+        }
+        xy.push_back(x);
+        xy.push_back(y);
+    }
+
+    std::vector<DimsType> candidates;
+    size_t                qtrCandidates = 0, bvhCandidates = 0;
+
+    t0 = std::chrono::steady_clock::now();
+    for (size_t p = 0; p < npoints; p++) {
+        qtr->GetPayloadContained(xy[2 * p], xy[2 * p + 1], candidates);
+        qtrCandidates += candidates.size();
+    }
+    double qtrQuery = Milliseconds(t0);
+
+    t0 = std::chrono::steady_clock::now();
+    for (size_t p = 0; p < npoints; p++) {
+        bvh->GetPayloadContained(xy[2 * p], xy[2 * p + 1], candidates);
+        bvhCandidates += candidates.size();
+    }
+    double bvhQuery = Milliseconds(t0);
+
+    std::vector<size_t> offsets;
+    t0 = std::chrono::steady_clock::now();
+    bvh->GetPayloadContained(xy.data(), npoints, offsets, candidates);
+    double bvhBatch = Milliseconds(t0);
+
+    std::printf("  Candidate query, %zu points\n", npoints);
+    std::printf("    quad tree %10.3f us/query, %6.2f candidates\n", 1000.0 * qtrQuery / npoints, (double)qtrCandidates / npoints);
+    std::printf("    BVH       %10.3f us/query, %6.2f candidates\n", 1000.0 * bvhQuery / npoints, (double)bvhCandidates / npoints);
+    std::printf("    BVH batch %10.3f us/query\n\n", 1000.0 * bvhBatch / npoints);
+
+    // Point location through the grid, with each locator
+    //
+    std::vector<DimsType> qtrCells(npoints), bvhCells(npoints);
+    std::vector<bool>     qtrFound(npoints), bvhFound(npoints);
+
+    t0 = std::chrono::steady_clock::now();
+    for (size_t p = 0; p < npoints; p++) qtrFound[p] = g->GetIndicesCell(CoordType{xy[2 * p], xy[2 * p + 1], 0.0}, qtrCells[p]);
+    double qtrLocate = Milliseconds(t0);
+
+    g->SetBVHRectangle(bvh);
+    t0 = std::chrono::steady_clock::now();
+    for (size_t p = 0; p < npoints; p++) bvhFound[p] = g->GetIndicesCell(CoordType{xy[2 * p], xy[2 * p + 1], 0.0}, bvhCells[p]);
+    double bvhLocate = Milliseconds(t0);
+    g->SetBVHRectangle(nullptr);
+
+    int nerrors = 0;
+    for (size_t p = 0; p < npoints; p++) {
+        if (qtrFound[p] != bvhFound[p] || (qtrFound[p] && qtrCells[p][0] != bvhCells[p][0])) nerrors++;
+    }
+
+    std::printf("  GetIndicesCell\n");
+    std::printf("    quad tree %10.3f us/query\n", 1000.0 * qtrLocate / npoints);
+    std::printf("    BVH       %10.3f us/query%s\n\n", 1000.0 * bvhLocate / npoints, nerrors ? " MISMATCH" : "");
+
+    if (!cacheDir.empty()) nerrors += BenchmarkCache(cacheDir, *qtr, *bvh, xy);
+
+    return (nerrors);
+}
+
+}    // namespace
+
+int main(int argc, char *argv[])
+{
+    const size_t npoints = 200000;
+
+    std::string cacheDir;
+    if (argc > 2 && std::string(argv[1]) == "-cache") {
+        cacheDir = argv[2];
+        argv += 2;
+        argc -= 2;
+    }
+
+    if (argc == 4 && std::string(argv[1]) == "-mpas") {
+        DataMgr dm("mpas", 2000);
+        if (dm.Initialize({argv[2]}, {}) < 0) {
+            std::cerr << "Failed to open " << argv[2] << std::endl;
+            return 1;
+        }
+        Grid *g = dm.GetVariable(0, argv[3], -1, -1, false);
+        if (!g || !dynamic_cast<UnstructuredGrid2D *>(g)) {
+            std::cerr << "Variable " << argv[3] << " is not a 2D unstructured variable" << std::endl;
+            return 1;
+        }
+        int nerrors = Benchmark(dynamic_cast<UnstructuredGrid2D *>(g), npoints, cacheDir);
+        delete g;
+        std::cout << (nerrors ? "FAILED" : "Passed") << std::endl;
+        return (nerrors ? 1 : 0);
+    }
+
+    if (argc < 2 || argc > 3) {
+        std::cout << "Help:  This program compares the QuadTreeRectangleP and BVHRectangle\n"
+                     "       cell locators on a 2D unstructured mesh, reporting build time,\n"
+                     "       candidate list lengths and query latency, and checks that both\n"
+                     "       locate the same cells.\n"
+                     "Usage: ./CellLocator [-cache dir] N [aspect]\n"
+                     "         Synthetic, graded triangle mesh with N x N nodes, stretched\n"
+                     "         along X by aspect (default 10)\n"
+                     "       ./CellLocator [-cache dir] -mpas file var\n"
+                     "         Mesh of the 2D variable var of an MPAS file\n"
+                     "       -cache dir\n"
+                     "         Also time storing the locators in, and loading them\n"
+                     "         from, a LocatorCache in directory dir\n";
+        return 1;
+    }
+
+    size_t n = std::stol(argv[1]);
+    double aspect = argc == 3 ? std::stod(argv[2]) : 10.0;
+    if (n < 2) n = 2;
+
+    mesh_t                              m;
+    std::unique_ptr<UnstructuredGrid2D> g(SyntheticMesh(n, aspect, m));
+    int                                 nerrors = Benchmark(g.get(), npoints, cacheDir);
+
+    std::cout << (nerrors ? "FAILED" : "Passed") << std::endl;
+    return (nerrors ? 1 : 0);
+}
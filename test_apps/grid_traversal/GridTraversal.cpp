@@ -0,0 +1,192 @@
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <cstdio>
+#include <vector>
+#include <array>
+#include <memory>
+#include <string>
+
+#include "vapor/RegularGrid.h"
+#include "vapor/StretchedGrid.h"
+#include "vapor/LayeredGrid.h"
+#include "vapor/CurvilinearGrid.h"
+#include "vapor/GridTraversal.h"
+
+#include "../smokeTests/gridTools.h"
+
+using namespace VAPoR;
+
+namespace {
+
+std::vector<double> Ramp(size_t n)
+{
+    std::vector<double> v;
+    for (size_t i = 0; i < n; i++) v.push_back((double)i);
+    return (v);
+}
+
+// Initialize the grid's values to a repeating ramp with a sprinkling of
+// missing values
+//
+void Fill(Grid *g)
+{
+    const DimsType &dims = g->GetDimensions();
+    g->SetMissingValue(-1.0);
+    g->SetHasMissingValues(true);
+
+    size_t idx = 0;
+    for (size_t k = 0; k < dims[2]; k++) {
+        for (size_t j = 0; j < dims[1]; j++) {
+            for (size_t i = 0; i < dims[0]; i++, idx++) { g->SetValueIJK(i, j, k, idx % 97 == 0 ? -1.0 : (float)(idx % 1013)); }
+        }
+    }
+}
+
+double Milliseconds(std::chrono::steady_clock::time_point t0) { return (std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count()); }
+
+// Compare the iterator path with the traversal kernels for grid type
+// GridT. Returns the number of mismatches
+//
+template<class GridT> int Compare(const std::string &name, const GridT *g)
+{
+    int   nerrors = 0;
+    float mv = g->GetMissingValue();
+
+    std::printf("%s grid (%zu, %zu, %zu)\n", name.c_str(), g->GetDimensions()[0], g->GetDimensions()[1], g->GetDimensions()[2]);
+
+    // Sum of valid values
+    //
+    auto   t0 = std::chrono::steady_clock::now();
+    double itrSum = 0.0;
+    size_t itrCount = 0;
+    auto   enditr = g->cend();
+    for (auto itr = g->cbegin(); itr != enditr; ++itr) {
+        if (*itr != mv) {
+            itrSum += *itr;
+            itrCount++;
+        }
+    }
+    double itrTime = Milliseconds(t0);
+
+    t0 = std::chrono::steady_clock::now();
+    double nodeSum = 0.0;
+    size_t nodeCount = 0;
+    ForEachNode(*g, [&](const DimsType &, float v) {
+        if (v != mv) {
+            nodeSum += v;
+            nodeCount++;
+        }
+    });
+    double nodeTime = Milliseconds(t0);
+
+    t0 = std::chrono::steady_clock::now();
+    double reduceSum = Reduce(
+        *g, 0.0, [](double acc, float v) { return (acc + v); }, [](double a, double b) { return (a + b); });
+    double reduceTime = Milliseconds(t0);
+
+    std::printf("  Iterator sum    : %.0f (%zu) %8.2f ms\n", itrSum, itrCount, itrTime);
+    std::printf("  ForEachNode sum : %.0f (%zu) %8.2f ms\n", nodeSum, nodeCount, nodeTime);
+    std::printf("  Reduce sum      : %.0f %8.2f ms\n", reduceSum, reduceTime);
+    if (itrSum != nodeSum || itrCount != nodeCount || itrSum != reduceSum) nerrors++;
+
+    // Range
+    //
+    float range[2];
+    t0 = std::chrono::steady_clock::now();
+    g->GetRange(range);
+    std::printf("  GetRange        : [%g, %g] %8.2f ms\n", range[0], range[1], Milliseconds(t0));
+    if (range[0] != 0.0 || range[1] != 1012.0) nerrors++;
+
+    // Cell corners, compared against GetCellNodes()
+    //
+    t0 = std::chrono::steady_clock::now();
+    size_t                ncells = 0;
+    size_t                nbad = 0;
+    std::vector<DimsType> nodes;
+    ForEachCell(*g, [&](const DimsType &cell, const float *values) {
+        if ((ncells++ % 101) != 0) return;
+        g->GetCellNodes(cell, nodes);
+
+        // GetCellNodes() returns corners counter-clockwise, values are
+        // ordered with I varying fastest
+        //
+        for (size_t n = 0; n < nodes.size(); n++) {
+            const DimsType &node = nodes[n];
+            size_t          corner = (node[0] - cell[0]) + 2 * (node[1] - cell[1]) + 4 * (node[2] - cell[2]);
+            if (values[corner] != g->GetValueAtIndex(node)) nbad++;
+        }
+    });
+    std::printf("  ForEachCell     : %zu cells %8.2f ms\n", ncells, Milliseconds(t0));
+    if (nbad) nerrors++;
+
+    if (nerrors) std::printf("  FAILED\n");
+    std::printf("\n");
+    return (nerrors);
+}
+
+}    // namespace
+
+int main(int argc, char *argv[])
+{
+    if (argc != 2) {
+        std::cout << "Help:  This program compares the Grid::ConstIterator path with the\n"
+                     "       ForEachNode(), ForEachCell() and Reduce() traversal kernels for\n"
+                     "       regular, stretched, layered and curvilinear grids of size\n"
+                     "       (Dim x Dim x Dim), reporting timings and any mismatches.\n"
+                     "Note:  the environment variable OMP_NUM_THREADS controls the number of\n"
+                     "       threads used by Reduce() and GetRange().\n"
+                     "Usage: ./GridTraversal Dim\n";
+        return 1;
+    }
+    const size_t   dim = std::stol(argv[1]);
+    const DimsType dims = {dim, dim, dim};
+    const DimsType bs = {64, 64, 64};
+    const DimsType dims2d = {dim, dim, 1};
+    const DimsType bs2d = {64, 64, 1};
+
+    int nerrors = 0;
+
+    std::unique_ptr<RegularGrid> rg(new RegularGrid(dims, bs, AllocateBlocks(bs, dims), {0.0, 0.0, 0.0}, {1.0, 1.0, 1.0}));
+    Fill(rg.get());
+    nerrors += Compare("Regular", rg.get());
+
+    std::unique_ptr<StretchedGrid> sg(new StretchedGrid(dims, bs, AllocateBlocks(bs, dims), Ramp(dim), Ramp(dim), Ramp(dim)));
+    Fill(sg.get());
+    nerrors += Compare("Stretched", sg.get());
+
+    RegularGrid zrg(dims, bs, AllocateBlocks(bs, dims), {0.0, 0.0, 0.0}, {1.0, 1.0, 1.0});
+    for (size_t k = 0; k < dim; k++) {
+        for (size_t j = 0; j < dim; j++) {
+            for (size_t i = 0; i < dim; i++) zrg.SetValueIJK(i, j, k, (float)k);
+        }
+    }
+    std::unique_ptr<LayeredGrid> lg(new LayeredGrid(dims, bs, AllocateBlocks(bs, dims), Ramp(dim), Ramp(dim), zrg));
+    Fill(lg.get());
+    nerrors += Compare("Layered", lg.get());
+
+    RegularGrid xrg(dims2d, bs2d, AllocateBlocks(bs2d, dims2d), {0.0, 0.0, 0.0}, {1.0, 1.0, 0.0});
+    RegularGrid yrg(dims2d, bs2d, AllocateBlocks(bs2d, dims2d), {0.0, 0.0, 0.0}, {1.0, 1.0, 0.0});
+    for (size_t j = 0; j < dim; j++) {
+        for (size_t i = 0; i < dim; i++) {
+            xrg.SetValueIJK(i, j, 0, (float)i);
+            yrg.SetValueIJK(i, j, 0, (float)j);
+        }
+    }
+    std::unique_ptr<CurvilinearGrid> cg(new CurvilinearGrid(dims, bs, AllocateBlocks(bs, dims), xrg, yrg, Ramp(dim), nullptr));
+    Fill(cg.get());
+    nerrors += Compare("Curvilinear", cg.get());
+
+    rg.reset();
+    sg.reset();
+    lg.reset();
+    cg.reset();
+    DeleteHeap();
+
+    if (nerrors) {
+        std::cout << "FAILED with " << nerrors << " errors" << std::endl;
+        return 1;
+    }
+    std::cout << "Passed" << std::endl;
+    return 0;
+}
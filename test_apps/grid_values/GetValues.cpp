@@ -0,0 +1,198 @@
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <cstdio>
+#include <cmath>
+#include <vector>
+#include <array>
+#include <memory>
+#include <random>
+#include <string>
+
+#include "vapor/RegularGrid.h"
+#include "vapor/StretchedGrid.h"
+#include "vapor/LayeredGrid.h"
+#include "vapor/CurvilinearGrid.h"
+
+#include "../smokeTests/gridTools.h"
+
+using namespace VAPoR;
+
+namespace {
+
+// Coordinates 0..n-1 with a gentle stretch
+//
+std::vector<double> Stretched(size_t n)
+{
+    std::vector<double> v;
+    for (size_t i = 0; i < n; i++) v.push_back((double)i + 0.002 * i * i);
+    return (v);
+}
+
+// Initialize the grid's values with a smooth function and a sprinkling
+// of missing values
+//
+void Fill(Grid *g)
+{
+    const DimsType &dims = g->GetDimensions();
+    g->SetMissingValue(-999.0);
+    g->SetHasMissingValues(true);
+
+    size_t idx = 0;
+    for (size_t k = 0; k < dims[2]; k++) {
+        for (size_t j = 0; j < dims[1]; j++) {
+            for (size_t i = 0; i < dims[0]; i++, idx++) {
+                float v = idx % 211 == 0 ? -999.0 : (float)(std::sin(0.1 * i) * std::cos(0.07 * j) + 0.01 * k);
+                g->SetValueIJK(i, j, k, v);
+            }
+        }
+    }
+}
+
+// Points along rows of a plane that slightly overhangs the grid, so some
+// fall outside of it. Rows give spatially coherent batches.
+//
+std::vector<double> SlicePoints(const Grid *g, size_t n)
+{
+    CoordType minu, maxu;
+    g->GetUserExtents(minu, maxu);
+
+    std::vector<double> xyz;
+    for (size_t j = 0; j < n; j++) {
+        for (size_t i = 0; i < n; i++) {
+            double s = (double)i / (n - 1);
+            double t = (double)j / (n - 1);
+            xyz.push_back(minu[0] - 0.05 * (maxu[0] - minu[0]) + 1.1 * s * (maxu[0] - minu[0]));
+            xyz.push_back(minu[1] + t * (maxu[1] - minu[1]));
+            xyz.push_back(minu[2] + (0.3 + 0.4 * s * t) * (maxu[2] - minu[2]));
+        }
+    }
+    return (xyz);
+}
+
+// Points scattered uniformly at random over the grid's extents
+//
+std::vector<double> RandomPoints(const Grid *g, size_t n)
+{
+    CoordType minu, maxu;
+    g->GetUserExtents(minu, maxu);
+
+    std::mt19937                           gen(42);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+
+    std::vector<double> xyz;
+    for (size_t p = 0; p < n; p++) {
+        for (int d = 0; d < 3; d++) xyz.push_back(minu[d] + dist(gen) * (maxu[d] - minu[d]));
+    }
+    return (xyz);
+}
+
+double Milliseconds(std::chrono::steady_clock::time_point t0) { return (std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count()); }
+
+// Compare GetValues() against the GetValue() reference for a set of
+// points. Returns the number of mismatches
+//
+int Compare(const std::string &name, const Grid *g, const std::vector<double> &xyz)
+{
+    size_t n = xyz.size() / 3;
+
+    auto               t0 = std::chrono::steady_clock::now();
+    std::vector<float> reference(n);
+    for (size_t p = 0; p < n; p++) reference[p] = g->GetValue(CoordType{xyz[3 * p], xyz[3 * p + 1], xyz[3 * p + 2]});
+    double scalarTime = Milliseconds(t0);
+
+    t0 = std::chrono::steady_clock::now();
+    std::vector<float> values(n);
+    g->GetValues(xyz.data(), n, values.data());
+    double batchTime = Milliseconds(t0);
+
+    int nerrors = 0;
+    for (size_t p = 0; p < n; p++) {
+        if (values[p] != reference[p] && !(std::isnan(values[p]) && std::isnan(reference[p]))) {
+            if (nerrors < 5) std::printf("    mismatch at point %zu: %g != %g\n", p, values[p], reference[p]);
+            nerrors++;
+        }
+    }
+
+    std::printf("  %-20s %8zu points : GetValue %8.2f ms, GetValues %8.2f ms%s\n", name.c_str(), n, scalarTime, batchTime, nerrors ? " FAILED" : "");
+    return (nerrors);
+}
+
+int Test(const std::string &name, const Grid *g, size_t dim)
+{
+    std::printf("%s grid (%zu, %zu, %zu)\n", name.c_str(), g->GetDimensions()[0], g->GetDimensions()[1], g->GetDimensions()[2]);
+
+    int nerrors = 0;
+    nerrors += Compare("slice", g, SlicePoints(g, 4 * dim));
+    nerrors += Compare("random", g, RandomPoints(g, 16 * dim * dim));
+    std::printf("\n");
+    return (nerrors);
+}
+
+}    // namespace
+
+int main(int argc, char *argv[])
+{
+    if (argc != 2) {
+        std::cout << "Help:  This program checks Grid::GetValues() against the scalar\n"
+                     "       Grid::GetValue() reference for regular, stretched, layered, and\n"
+                     "       curvilinear grids of size (Dim x Dim x Dim) and reports the time taken by each.\n"
+                     "Usage: ./GetValues Dim\n";
+        return 1;
+    }
+    const size_t   dim = std::stol(argv[1]);
+    const DimsType dims = {dim, dim, dim};
+    const DimsType bs = {64, 64, 64};
+
+    int nerrors = 0;
+
+    std::unique_ptr<RegularGrid> rg(new RegularGrid(dims, bs, AllocateBlocks(bs, dims), {0.0, 0.0, 0.0}, {1.0, 2.0, 3.0}));
+    Fill(rg.get());
+    nerrors += Test("Regular", rg.get(), dim);
+
+    std::unique_ptr<StretchedGrid> sg(new StretchedGrid(dims, bs, AllocateBlocks(bs, dims), Stretched(dim), Stretched(dim), Stretched(dim)));
+    Fill(sg.get());
+    nerrors += Test("Stretched", sg.get(), dim);
+
+    // Terrain following layers
+    //
+    RegularGrid zrg(dims, bs, AllocateBlocks(bs, dims), {0.0, 0.0, 0.0}, {1.0, 1.0, 1.0});
+    for (size_t k = 0; k < dim; k++) {
+        for (size_t j = 0; j < dim; j++) {
+            for (size_t i = 0; i < dim; i++) zrg.SetValueIJK(i, j, k, (float)(k + 0.2 * std::sin(0.2 * i) * (dim - k) / dim));
+        }
+    }
+    std::unique_ptr<LayeredGrid> lg(new LayeredGrid(dims, bs, AllocateBlocks(bs, dims), Stretched(dim), Stretched(dim), zrg));
+    lg->SetInterpolationOrder(1);
+    Fill(lg.get());
+    nerrors += Test("Layered", lg.get(), dim);
+
+    // Warped horizontal coordinates, with stretched layers
+    //
+    const DimsType dims2d = {dim, dim, 1};
+    const DimsType bs2d = {64, 64, 1};
+    RegularGrid    xrg(dims2d, bs2d, AllocateBlocks(bs2d, dims2d), {0.0, 0.0, 0.0}, {1.0, 1.0, 0.0});
+    RegularGrid    yrg(dims2d, bs2d, AllocateBlocks(bs2d, dims2d), {0.0, 0.0, 0.0}, {1.0, 1.0, 0.0});
+    for (size_t j = 0; j < dim; j++) {
+        for (size_t i = 0; i < dim; i++) {
+            xrg.SetValueIJK(i, j, 0, (float)(i + 0.3 * std::sin(0.2 * j)));
+            yrg.SetValueIJK(i, j, 0, (float)(j + 0.3 * std::sin(0.2 * i)));
+        }
+    }
+    std::unique_ptr<CurvilinearGrid> cg(new CurvilinearGrid(dims, bs, AllocateBlocks(bs, dims), xrg, yrg, Stretched(dim), nullptr));
+    Fill(cg.get());
+    nerrors += Test("Curvilinear", cg.get(), dim);
+
+    rg.reset();
+    sg.reset();
+    lg.reset();
+    cg.reset();
+    DeleteHeap();
+
+    if (nerrors) {
+        std::cout << "FAILED with " << nerrors << " errors" << std::endl;
+        return 1;
+    }
+    std::cout << "Passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,103 @@
+#include <iostream>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+#include <string>
+
+#include "vapor/PythonDataMgr.h"
+
+using namespace VAPoR;
+
+namespace {
+
+// The value of voxel idx of variable var. Exactly representable, and
+// distinct across variables, so that data from the wrong region is
+// detected
+//
+float Value(size_t var, size_t idx) { return ((float)(idx % 4096) + 4096.0f * var); }
+
+std::string VarName(size_t var) { return ("v" + std::to_string(var)); }
+
+// "Render" an unlocked grid by visiting every voxel a few times, as a
+// renderer would while the prefetch threads fill the cache, and count
+// the voxels whose values are not those of variable var
+//
+size_t Render(const Grid *g, size_t var, int npasses)
+{
+    const DimsType &dims = g->GetDimensions();
+
+    size_t nerrors = 0;
+    for (int pass = 0; pass < npasses; pass++) {
+        size_t idx = 0;
+        for (size_t k = 0; k < dims[2]; k++) {
+            for (size_t j = 0; j < dims[1]; j++) {
+                for (size_t i = 0; i < dims[0]; i++, idx++) {
+                    if (g->GetValueAtIndex(DimsType{i, j, k}) != Value(var, idx)) nerrors++;
+                }
+            }
+        }
+    }
+    return (nerrors);
+}
+
+}    // namespace
+
+int main(int argc, char *argv[])
+{
+    if (argc != 4) {
+        std::cout << "Help:  This program renders unlocked grids from a DataMgr whose cache holds\n"
+                     "       only a few variables of size (Dim x Dim x Dim), while prefetching the\n"
+                     "       variables of the next Ahead frames. Prefetching must never evict the\n"
+                     "       regions of a grid in use, so any voxel with the wrong value is an error.\n"
+                     "Usage: ./Prefetch Dim Frames Ahead\n";
+        return 1;
+    }
+    const size_t dim = std::stol(argv[1]);
+    const size_t nframes = std::stol(argv[2]);
+    const size_t ahead = std::stol(argv[3]);
+    const size_t nvars = ahead + 4;
+
+    // Room for about three variables
+    //
+    size_t        varMB = (dim * dim * dim * sizeof(float) + (1024 * 1024 - 1)) / (1024 * 1024);
+    PythonDataMgr dm("ram", 3 * varMB + 2);
+    if (dm.Initialize({"dummy"}, {}) < 0) {
+        std::printf("Failed to initialize data manager\n");
+        return 1;
+    }
+
+    std::vector<std::vector<float>> data(nvars);
+    for (size_t var = 0; var < nvars; var++) {
+        data[var].resize(dim * dim * dim);
+        for (size_t idx = 0; idx < data[var].size(); idx++) data[var][idx] = Value(var, idx);
+        dm.AddRegularData(VarName(var), data[var].data(), {(int)dim, (int)dim, (int)dim});
+    }
+
+    CoordType min = {0.0, 0.0, 0.0};
+    CoordType max = {(double)dim - 1, (double)dim - 1, (double)dim - 1};
+
+    size_t nerrors = 0;
+    size_t nfailed = 0;
+    auto   start = std::chrono::steady_clock::now();
+    for (size_t frame = 0; frame < nframes; frame++) {
+        size_t var = frame % nvars;
+
+        std::vector<std::string> upcoming;
+        for (size_t i = 1; i <= ahead; i++) upcoming.push_back(VarName((frame + i) % nvars));
+
+        Grid *g = dm.GetVariable(0, VarName(var), -1, -1, min, max, false);
+        if (!g) {
+            nfailed++;
+            continue;
+        }
+
+        dm.Prefetch(0, upcoming, -1, -1, min, max);
+        nerrors += Render(g, var, 2);
+        delete g;
+    }
+    dm.CancelPrefetch();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::printf("%zu frames in %.2f s : %zu failed reads, %zu bad voxels%s\n", nframes, seconds, nfailed, nerrors, nerrors || nfailed ? " FAILED" : "");
+    return (nerrors || nfailed ? 1 : 0);
+}
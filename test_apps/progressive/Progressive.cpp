@@ -0,0 +1,88 @@
+#include <iostream>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <string>
+
+#include "vapor/DataMgr.h"
+
+using namespace VAPoR;
+
+int main(int argc, char *argv[])
+{
+    if (argc != 4) {
+        std::cout << "Help:  This program fills a DataMgr cache of MemSize MB with the time steps of\n"
+                     "       variable Var of the VDC file, then reads time step 0 progressively and\n"
+                     "       checks that the finest refinement is delivered although the cache is full.\n"
+                     "       MemSize must hold at least the finest resolution of Var.\n"
+                     "Usage: ./Progressive file.vdc Var MemSize\n";
+        return 1;
+    }
+    const std::string file = argv[1];
+    const std::string varname = argv[2];
+    const size_t      memsize = std::stol(argv[3]);
+
+    DataMgr dm("vdc", memsize);
+    if (dm.Initialize({file}, {}) < 0) {
+        std::printf("Failed to initialize data manager\n");
+        return 1;
+    }
+    if (!dm.VariableExists(0, varname, -1, -1)) {
+        std::printf("No variable %s\n", varname.c_str());
+        return 1;
+    }
+
+    int nlevels = dm.GetNumRefLevels(varname);
+    int nlods = dm.GetCRatios(varname).size();
+
+    // Fill the cache, starting with the last time step, until regions
+    // are evicted or all of the time steps are cached
+    //
+    size_t nts = dm.GetNumTimeSteps(varname);
+    for (size_t ts = nts; ts > 1 && dm.GetCacheStats().evictions == 0; ts--) {
+        Grid *g = dm.GetVariable(ts - 1, varname, -1, -1, false);
+        if (g) delete g;
+    }
+
+    CoordType min, max;
+    if (dm.GetVariableExtents(0, varname, -1, -1, min, max) < 0) {
+        std::printf("Failed to get extents of %s\n", varname.c_str());
+        return 1;
+    }
+
+    std::mutex              mutex;
+    std::condition_variable cv;
+    int                     finest = -1;
+    size_t                  nrefinements = 0;
+
+    auto  start = std::chrono::steady_clock::now();
+    Grid *g = dm.GetVariableProgressive(0, varname, -1, -1, min, max, [&](Grid *h, int level, int lod) {
+        dm.UnlockGrid(h);
+        delete h;
+
+        std::unique_lock<std::mutex> guard(mutex);
+        nrefinements++;
+        if (level == nlevels - 1 && lod == nlods - 1) finest = level;
+        cv.notify_all();
+    });
+    if (!g) {
+        std::printf("Failed to read %s progressively\n", varname.c_str());
+        return 1;
+    }
+    dm.UnlockGrid(g);
+    delete g;
+
+    bool ok = true;
+    if (nlevels > 1 || nlods > 1) {
+        std::unique_lock<std::mutex> guard(mutex);
+        ok = cv.wait_for(guard, std::chrono::seconds(60), [&] { return (finest >= 0); });
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    DataMgr::CacheStats stats = dm.GetCacheStats();
+    std::printf("%zu refinements in %.2f s, %zu evictions : finest refinement %s%s\n", nrefinements, seconds, stats.evictions, ok ? "delivered" : "not delivered", ok ? "" : " FAILED");
+    return (ok ? 0 : 1);
+}
@@ -68,6 +68,8 @@ template<typename T> vector<T *> AllocateBlocksType(const vector<size_t> &bs, co
 
 vector<float *> AllocateBlocks(const vector<size_t> &bs, const vector<size_t> &dims) { return (AllocateBlocksType<float>(bs, dims)); }
 
+vector<float *> AllocateBlocks(const DimsType &bs, const DimsType &dims) { return (AllocateBlocksType<float>(vector<size_t>(bs.begin(), bs.end()), vector<size_t>(dims.begin(), dims.end()))); }
+
 void MakeTriangle(Grid *grid, float minVal, float maxVal, bool addRandomMissingValues)
 {
     auto   dims = grid->GetDimensions();
@@ -10,6 +10,8 @@ void DeleteHeap();
 
 std::vector<float *> AllocateBlocks(const std::vector<size_t> &bs, const std::vector<size_t> &dims);
 
+std::vector<float *> AllocateBlocks(const VAPoR::DimsType &bs, const VAPoR::DimsType &dims);
+
 void MakeTriangle(VAPoR::Grid *grid, float minVal, float maxVal, bool addRandomMissingValues=true);
 
 void MakeConstantField(VAPoR::Grid *grid, float value, bool addRandomMissingValues=true);
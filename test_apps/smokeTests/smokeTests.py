@@ -103,6 +103,7 @@ dataMgrs = {
 
 gridProgram        = binaryRoot + "testGrid"
 dataMgrProgram     = binaryRoot + "testDataMgr"
+subMeshProgram     = binaryRoot + "testSubMesh"
 gridResultsFile    = resultsDir + "gridResults.txt"
 dataMgrResultsFile = resultsDir + "dataMgrResults.txt"
 
@@ -141,6 +142,24 @@ def testGrid( grid ):
 
     return rc
 
+def testSubMesh():
+    print( "Testing sub-mesh connectivity" )
+
+    print("  Command: " + subMeshProgram )
+    programOutput = subprocess.run(
+        [ subMeshProgram ],
+        stdout=subprocess.PIPE,
+        universal_newlines=True
+    )
+
+    if ( programOutput.returncode != 0 ):
+        print( programOutput.stdout )
+        print( "  Test failed with exit code " + str(programOutput.returncode) )
+        return 1
+
+    print( "  Test passed\n" )
+    return 0
+
 def testDataMgr( dataMgrType, dataMgr, makeBaseline=False ):
     print( "Testing " + dataMgrType + " with " + dataMgr )
     command = []
@@ -230,6 +249,9 @@ def main():
             print ("  See artifact file " + grid + ".txt or " + resultsDir + grid + ".txt for mismatches")
             print ("  Failed assertions, if any, are shown above.\n" )
             rc = 1
+
+    if ( testSubMesh() != 0 ):
+        rc = 1
  
     for dataType, dataFile in dataMgrs.items():
         baselineFile = resultsDir + dataType + "_baseline.txt"
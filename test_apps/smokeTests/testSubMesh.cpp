@@ -0,0 +1,140 @@
+// This test exercises the extraction of the connectivity of a sub-mesh
+// of an unstructured mesh, used by DataMgr::GetVariable() to subset
+// unstructured variables by spatial extents.
+//
+// A small mesh of four faces on a 3x3 lattice of nodes is subset by
+// node index ranges. The test checks which faces are kept, that node
+// and face references are remapped to the sub-mesh, that references to
+// faces outside of the sub-mesh become boundary references, and that
+// the node-face connectivity starts at the first node of the range.
+//
+// Functions under test:
+//  DataMgrUtils::MakeSubMesh(
+//    const int *faceNode, const int *nodeFace, const int *faceFace,
+//    size_t nfaces, size_t maxVertexPerFace, size_t maxFacePerVertex,
+//    long vertexOffset, long faceOffset, size_t n0, size_t n1,
+//    std::vector <int> &subFaceNode, std::vector <int> &subNodeFace,
+//    std::vector <int> &subFaceFace
+//  )
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <vapor/DataMgrUtils.h>
+
+using namespace VAPoR;
+
+namespace {
+
+const int M = -1;    // missing
+const int B = -2;    // boundary
+
+// Nodes are numbered j * 3 + i on a 3x3 lattice:
+//
+//   6 --- 7 --- 8
+//   |  2  |  3 /
+//   3 --- 4 --- 5
+//   |  0  |  1  |
+//   0 --- 1 --- 2
+//
+// Face 3 is a triangle. References are zero based
+//
+const size_t maxVertexPerFace = 4;
+const size_t maxFacePerVertex = 4;
+const size_t nfaces = 4;
+
+const std::vector<int> faceNode = {0, 1, 4, 3, 1, 2, 5, 4, 3, 4, 7, 6, 4, 5, 8, M};
+
+const std::vector<int> faceFace = {B, 1, 2, B, B, B, 3, 0, 0, 3, B, B, 1, B, 2, M};
+
+const std::vector<int> nodeFace = {0, M, M, M, 0, 1, M, M, 1, M, M, M, 0, 2, M, M, 0, 1, 2, 3, 1, 3, M, M, 2, M, M, M, 2, 3, M, M, 3, M, M, M};
+
+// Add offset to each reference that is neither missing nor boundary
+//
+std::vector<int> Offset(const std::vector<int> &v, int offset)
+{
+    std::vector<int> w;
+    for (auto id : v) w.push_back(id == M || id == B ? id : id + offset);
+    return (w);
+}
+
+std::string ToString(const std::vector<int> &v)
+{
+    std::string s;
+    for (auto id : v) s += std::to_string(id) + " ";
+    return (s);
+}
+
+int Compare(const std::string &name, const std::vector<int> &result, const std::vector<int> &expected)
+{
+    std::cout << "  " << name << ": " << ToString(result) << std::endl;
+    if (result == expected) return (0);
+
+    std::cout << "    FAILED, expected: " << ToString(expected) << std::endl;
+    return (1);
+}
+
+// Subset the mesh, stored with references starting at base, by the node
+// range [n0, n1], and compare with the expected sub-mesh
+//
+int Test(int base, size_t n0, size_t n1, size_t expectedFaces, const std::vector<int> &expectedFaceNode, const std::vector<int> &expectedNodeFace, const std::vector<int> &expectedFaceFace)
+{
+    std::cout << "Nodes [" << n0 << ", " << n1 << "], references start at " << base << std::endl;
+
+    std::vector<int> fn = Offset(faceNode, base);
+    std::vector<int> nf = Offset(nodeFace, base);
+    std::vector<int> ff = Offset(faceFace, base);
+
+    std::vector<int> subFaceNode, subNodeFace, subFaceFace;
+    size_t           n = DataMgrUtils::MakeSubMesh(fn.data(), nf.data(), ff.data(), nfaces, maxVertexPerFace, maxFacePerVertex, -base, -base, n0, n1, subFaceNode, subNodeFace, subFaceFace);
+
+    int rc = 0;
+    std::cout << "  faces: " << n << std::endl;
+    if (n != expectedFaces) {
+        std::cout << "    FAILED, expected: " << expectedFaces << std::endl;
+        rc = 1;
+    }
+    rc += Compare("face-node", subFaceNode, expectedFaceNode);
+    rc += Compare("node-face", subNodeFace, expectedNodeFace);
+    rc += Compare("face-face", subFaceFace, expectedFaceFace);
+
+    // Optional connectivity variables may be omitted
+    //
+    n = DataMgrUtils::MakeSubMesh(fn.data(), NULL, NULL, nfaces, maxVertexPerFace, maxFacePerVertex, -base, -base, n0, n1, subFaceNode, subNodeFace, subFaceFace);
+    if (n != expectedFaces || subFaceNode != expectedFaceNode || !subNodeFace.empty() || !subFaceFace.empty()) {
+        std::cout << "  FAILED without node-face and face-face connectivity" << std::endl;
+        rc++;
+    }
+
+    std::cout << std::endl;
+    return (rc);
+}
+
+}    // namespace
+
+int main(int argc, char **argv)
+{
+    int rc = 0;
+
+    // The top row keeps faces 2 and 3. Faces 0 and 1 become boundaries
+    //
+    for (int base : {0, 1}) {
+        rc += Test(base, 3, 8, 2, {0, 1, 4, 3, 1, 2, 5, M}, {B, 0, M, M, B, B, 0, 1, B, 1, M, M, 0, M, M, M, 0, 1, M, M, 1, M, M, M}, {B, 1, B, B, B, B, 0, M});
+    }
+
+    // Nodes 0 through 5 keep faces 0 and 1 only
+    //
+    rc += Test(0, 0, 5, 2, {0, 1, 4, 3, 1, 2, 5, 4}, {0, M, M, M, 0, 1, M, M, 1, M, M, M, 0, B, M, M, 0, 1, B, B, 1, B, M, M}, {B, 1, B, B, B, B, B, 0});
+
+    // Every face has a node outside of nodes 2 through 5
+    //
+    rc += Test(1, 2, 5, 0, {}, {B, M, M, M, B, B, M, M, B, B, B, B, B, B, M, M}, {});
+
+    // The whole mesh
+    //
+    rc += Test(1, 0, 8, 4, faceNode, nodeFace, faceFace);
+
+    std::cout << (rc ? "Sub-mesh tests failed" : "Sub-mesh tests passed") << std::endl;
+    return (rc ? 1 : 0);
+}